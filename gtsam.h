@@ -2056,6 +2056,7 @@ class NonlinearFactorGraph {
   // NonlinearFactorGraph
   void printErrors(const gtsam::Values& values) const;
   double error(const gtsam::Values& values) const;
+  Vector errors(const gtsam::Values& values) const;
   double probPrime(const gtsam::Values& values) const;
   gtsam::Ordering orderingCOLAMD() const;
   // Ordering* orderingCOLAMDConstrained(const gtsam::Values& c, const std::map<gtsam::Key,int>& constraints) const;
@@ -2253,6 +2254,8 @@ virtual class NonlinearOptimizerParams {
   void setOrdering(const gtsam::Ordering& ordering);
   string getOrderingType() const;
   void setOrderingType(string ordering);
+  double getParallelEliminationThreshold() const;
+  void setParallelEliminationThreshold(double value);
 
   bool isMultifrontal() const;
   bool isSequential() const;
@@ -2279,6 +2282,8 @@ virtual class LevenbergMarquardtParams : gtsam::NonlinearOptimizerParams {
   double getlambdaLowerBound() const;
   double getlambdaUpperBound() const;
   bool getUseFixedLambdaFactor();
+  bool getReuseEliminationStructure() const;
+  double getRelinearizeThreshold() const;
   string getLogFile() const;
   string getVerbosityLM() const;
 
@@ -2288,6 +2293,8 @@ virtual class LevenbergMarquardtParams : gtsam::NonlinearOptimizerParams {
   void setlambdaLowerBound(double value);
   void setlambdaUpperBound(double value);
   void setUseFixedLambdaFactor(bool flag);
+  void setReuseEliminationStructure(bool flag);
+  void setRelinearizeThreshold(double value);
   void setLogFile(string s);
   void setVerbosityLM(string s);
 
@@ -2414,6 +2421,12 @@ class ISAM2Params {
   void setEnableDetailedResults(bool enableDetailedResults);
   bool isEnablePartialRelinearizationCheck() const;
   void setEnablePartialRelinearizationCheck(bool enablePartialRelinearizationCheck);
+  double getParallelEliminationThreshold() const;
+  void setParallelEliminationThreshold(double parallelEliminationThreshold);
+  size_t getParallelLinearizationThreshold() const;
+  void setParallelLinearizationThreshold(size_t parallelLinearizationThreshold);
+  string getOrderingType() const;
+  void setOrderingType(string orderingType);
 };
 
 class ISAM2Clique {
@@ -2434,6 +2447,8 @@ class ISAM2Result {
   /** Getters and Setters for all properties */
   size_t getVariablesRelinearized() const;
   size_t getVariablesReeliminated() const;
+  size_t getVariablesRetracted() const;
+  double getRetractTime() const;
   size_t getCliques() const;
 };
 
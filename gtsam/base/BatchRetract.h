@@ -0,0 +1,47 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file BatchRetract.h
+ * @brief Retract many values of the same type at once, as Values::retract does
+ * @date Oct 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/Manifold.h>
+
+#include <cstddef>
+
+namespace gtsam {
+namespace internal {
+
+/**
+ * Retract a batch of values of type T. Run calls output(i, retracted) with the retraction of
+ * value(i) by delta(i), for each i in [0, n).
+ *
+ * The default retracts one value at a time with traits<T>::Retract. Types whose retraction is
+ * fixed-size arithmetic specialize this with a structure-of-arrays kernel, which gathers a
+ * chunk of values into one array per coefficient so the compiler vectorizes the arithmetic
+ * across values, e.g. Pose3 and Rot3 with the Cayley chart. A specialization has to give the
+ * same result as traits<T>::Retract, up to rounding.
+ */
+template <class T>
+struct BatchRetract {
+  template <class VALUE, class DELTA, class OUTPUT>
+  static void Run(size_t n, const VALUE& value, const DELTA& delta, const OUTPUT& output) {
+    for (size_t i = 0; i < n; ++i)
+      output(i, traits<T>::Retract(value(i), delta(i)));
+  }
+};
+
+}  // namespace internal
+}  // namespace gtsam
@@ -19,9 +19,12 @@
 
 #pragma once
 
+#include <gtsam/base/BatchRetract.h>
 #include <gtsam/base/Manifold.h>
 #include <gtsam/base/types.h>
 #include <gtsam/base/Value.h>
+#include <gtsam/base/ValueArena.h>
+#include <gtsam/config.h> // for GTSAM_VALUES_ARENA
 
 #include <boost/make_shared.hpp>
 #include <boost/pool/pool_alloc.hpp>
@@ -121,6 +124,22 @@ public:
       return resultAsValue;
     }
 
+    /// Retract a batch of GenericValue<T> with the batch kernel of T, see BatchRetract
+    virtual void retractBatch_(size_t n, const Value* const* values,
+                               const Vector* const* deltas, Value** result) const {
+      internal::BatchRetract<T>::Run(n,
+          [values](size_t i) -> const T& {
+            return static_cast<const GenericValue&>(*values[i]).value_;
+          },
+          [deltas](size_t i) -> const Vector& { return *deltas[i]; },
+          [result](size_t i, const T& retracted) { result[i] = new GenericValue(retracted); });
+    }
+
+    /// Retract in place, without the heap allocation of retract_
+    virtual void retractInPlace_(const Vector& delta) {
+      value_ = traits<T>::Retract(value_, delta);
+    }
+
     /// Generic Value interface version of localCoordinates
     virtual Vector localCoordinates_(const Value& value2) const {
       // Cast the base class Value pointer to a templated generic class pointer
@@ -178,10 +197,38 @@ public:
 	}
 
 
+#ifdef GTSAM_VALUES_ARENA
+public:
+  /// Allocate from the arena of this type, which also takes care of alignment
+  static void* operator new(std::size_t size) {
+    if (size != sizeof(GenericValue))
+      return Eigen::internal::conditional_aligned_malloc<true>(size);
+    return internal::ValueArena<GenericValue>::allocate();
+  }
+
+  /// Return memory obtained from operator new to the arena
+  static void operator delete(void* ptr, std::size_t size) {
+    if (!ptr) return;
+    if (size != sizeof(GenericValue))
+      Eigen::internal::conditional_aligned_free<true>(ptr);
+    else
+      internal::ValueArena<GenericValue>::deallocate(ptr);
+  }
+
+  static void* operator new[](std::size_t size) {
+    return Eigen::internal::conditional_aligned_malloc<true>(size);
+  }
+  static void operator delete[](void* ptr) {
+    Eigen::internal::conditional_aligned_free<true>(ptr);
+  }
+  static void* operator new(std::size_t, void* ptr) { return ptr; }
+  static void operator delete(void*, void*) {}
+#else
   // Alignment, see https://eigen.tuxfamily.org/dox/group__TopicStructHavingEigenMembers.html
   enum { NeedsToAlign = (sizeof(T) % 16) == 0 };
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW_IF(NeedsToAlign)
+#endif
 };
 
 /// use this macro instead of BOOST_CLASS_EXPORT for GenericValues
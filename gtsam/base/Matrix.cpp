@@ -20,12 +20,17 @@
 #include <gtsam/base/timing.h>
 #include <gtsam/base/Vector.h>
 #include <gtsam/base/FastList.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
 #include <Eigen/SVD>
 #include <Eigen/LU>
 
 #include <boost/tuple/tuple.hpp>
 #include <boost/tokenizer.hpp>
 
+#ifdef GTSAM_USE_TBB
+#  include <tbb/parallel_for.h>
+#endif
+
 #include <cstdarg>
 #include <cstring>
 #include <iomanip>
@@ -627,6 +632,48 @@ std::string formatMatrixIndented(const std::string& label, const Matrix& matrix,
   return ss.str();
 }
 
+#ifdef GTSAM_USE_TBB
+/* ************************************************************************* */
+// Blocked Householder QR as in Eigen's householder_qr_inplace_blocked, except
+// that the reflectors of each panel are applied to the trailing columns in
+// parallel, so that large cliques do not leave all but one thread idle.
+static const size_t parallelQRThreshold = 512;
+
+template <class HCOEFFS>
+static void householderQRParallel(Matrix& A, HCOEFFS& hCoeffs, double* temp) {
+  static const DenseIndex panelWidth = 48, chunkWidth = 4 * panelWidth;
+  const DenseIndex rows = A.rows(), cols = A.cols(), size = std::min(rows, cols);
+  for (DenseIndex k = 0; k < size; k += panelWidth) {
+    const DenseIndex width = std::min(size - k, panelWidth);
+    const DenseIndex trailing = cols - k - width;
+
+    // Factor the panel
+    auto V = A.block(k, k, rows - k, width);
+    auto panelCoeffs = hCoeffs.segment(k, width);
+    Eigen::internal::householder_qr_inplace_unblocked(V, panelCoeffs, temp);
+    if (trailing == 0)
+      continue;
+
+    // A -= V T' V' A on the trailing columns, with the triangular factor T of
+    // the block reflector computed once for all chunks
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> T(width, width);
+    Eigen::internal::make_block_householder_triangular_factor(T, V, panelCoeffs);
+    const DenseIndex nrChunks = (trailing + chunkWidth - 1) / chunkWidth;
+    tbb::parallel_for(tbb::blocked_range<DenseIndex>(0, nrChunks),
+        [&](const tbb::blocked_range<DenseIndex>& range) {
+          for (DenseIndex chunk = range.begin(); chunk != range.end(); ++chunk) {
+            const DenseIndex begin = chunk * chunkWidth;
+            auto C = A.block(k, k + width + begin, rows - k,
+                             std::min(chunkWidth, trailing - begin));
+            Matrix W = V.transpose().triangularView<Eigen::UnitUpper>() * C;
+            W = T.transpose().triangularView<Eigen::Lower>() * W;
+            C.noalias() -= V.triangularView<Eigen::UnitLower>() * W;
+          }
+        });
+  }
+}
+#endif
+
 /* ************************************************************************* */
 void inplace_QR(Matrix& A){
   size_t rows = A.rows();
@@ -638,6 +685,14 @@ void inplace_QR(Matrix& A){
   HCoeffsType hCoeffs(size);
   RowVectorType temp(cols);
 
+#ifdef GTSAM_USE_TBB
+  if (cols >= parallelQRThreshold) {
+    householderQRParallel(A, hCoeffs, temp.data());
+    zeroBelowDiagonal(A);
+    return;
+  }
+#endif
+
 #if !EIGEN_VERSION_AT_LEAST(3,2,5)
   Eigen::internal::householder_qr_inplace_blocked<Matrix, HCoeffsType>(A, hCoeffs, 48, temp.data());
 #else
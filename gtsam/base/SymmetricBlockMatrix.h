@@ -217,7 +217,7 @@ namespace gtsam {
     void updateDiagonalBlock(DenseIndex I, const XprType& xpr) {
       // TODO(gareth): Eigen won't let us add triangular or self-adjoint views
       // here, so we do it manually.
-      auto dest = block_(I, I);
+      auto dest = sizedBlock_<XprType::RowsAtCompileTime, XprType::ColsAtCompileTime>(I, I);
       assert(dest.rows() == xpr.rows());
       assert(dest.cols() == xpr.cols());
       for (DenseIndex col = 0; col < dest.cols(); ++col) {
@@ -227,15 +227,22 @@ namespace gtsam {
       }
     }
 
+    /// Increment the diagonal of the diagonal block I by the entries of vector `xpr`.
+    template <typename XprType>
+    void updateDiagonalBlockDiagonal(DenseIndex I, const XprType& xpr) {
+      block_(I, I).diagonal() += xpr;
+    }
+
     /// Update an off diagonal block.
     /// NOTE(emmett): This assumes noalias().
     template <typename XprType>
     void updateOffDiagonalBlock(DenseIndex I, DenseIndex J, const XprType& xpr) {
       assert(I != J);
       if (I < J) {
-        block_(I, J).noalias() += xpr;
+        sizedBlock_<XprType::RowsAtCompileTime, XprType::ColsAtCompileTime>(I, J).noalias() += xpr;
       } else {
-        block_(J, I).noalias() += xpr.transpose();
+        sizedBlock_<XprType::ColsAtCompileTime, XprType::RowsAtCompileTime>(J, I).noalias() +=
+            xpr.transpose();
       }
     }
 
@@ -345,6 +352,15 @@ namespace gtsam {
       return matrix_.block(indices[0], indices[1], indices[2], indices[3]);
     }
 
+    /// Get block (I, J) as an Eigen block of the given compile-time size, which may be Dynamic,
+    /// so that updates with fixed-size expressions compile to fixed-size loops.
+    template <int ROWS, int COLS>
+    Eigen::Block<Matrix, ROWS, COLS> sizedBlock_(DenseIndex I, DenseIndex J) {
+      const std::array<DenseIndex, 4> indices = calcIndices(I, J, 1, 1);
+      return Eigen::Block<Matrix, ROWS, COLS>(matrix_, indices[0], indices[1], indices[2],
+                                             indices[3]);
+    }
+
     /// Get the full matrix as a block.
     constBlock full() const {
       return block_(0, 0, nBlocks(), nBlocks());
@@ -66,6 +66,31 @@ namespace gtsam {
      */
     virtual Value* retract_(const Vector& delta) const = 0;
 
+    /** Retract a batch of values of the same concrete type as this one, as
+     * Values::retract does. The default calls retract_() on each of them,
+     * GenericValue overrides this with the batch kernel of its type.
+     * @param n The number of values in the batch
+     * @param values The values to retract, all of the same type as \c this
+     * @param deltas The delta vector for each value
+     * @param result The retracted values, to be deallocated with deallocate_()
+     */
+    virtual void retractBatch_(size_t n, const Value* const* values,
+                               const Vector* const* deltas, Value** result) const {
+      for (size_t i = 0; i < n; ++i)
+        result[i] = values[i]->retract_(*deltas[i]);
+    }
+
+    /** Increment this value in place, as retract_() would, but without
+     * allocating a new value. The default goes through retract_(),
+     * GenericValue overrides it to assign the retracted value directly.
+     * @param delta The delta vector in the tangent space of this value
+     */
+    virtual void retractInPlace_(const Vector& delta) {
+      Value* retracted = retract_(delta);
+      *this = *retracted;
+      retracted->deallocate_();
+    }
+
     /** Compute the coordinates in the tangent space of this value that
      * retract() would map to \c value.
      * @param value The value whose coordinates should be determined in the
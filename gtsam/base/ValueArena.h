@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file ValueArena.h
+ * @brief Per-type memory arenas for the variables stored in Values
+ * @date Oct 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace gtsam {
+namespace internal {
+
+/**
+ * A pool of equally sized, suitably aligned memory slots for objects of type T.
+ *
+ * Slots are carved out of large blocks that are handed out in address order, so objects
+ * allocated one after the other, e.g. when copying or retracting a Values, end up next to
+ * each other in memory. Freed slots are recycled by later allocations.
+ *
+ * Each thread allocates from and frees to its own list of at most 2 * BatchSize slots, and
+ * only takes the lock of the shared list to move BatchSize slots at once, so threads that
+ * linearize or parse in parallel do not contend on every allocation. Blocks start small and
+ * double in size. Freed slots are kept for reuse rather than returned to the system, so the
+ * memory of the arena stays at its high-water mark until the arena is destroyed at program
+ * exit, which frees all blocks. Values destroyed after that, during static destruction, are
+ * not returned to the arena anymore.
+ */
+template <class T>
+class ValueArena {
+ public:
+  /// Return uninitialized memory for one T
+  static void* allocate() {
+    if (Destroyed()) return allocateAligned(1, nullptr);  // leaked, the program is exiting
+    LocalCache& cache = Local();
+    if (cache.closed) return Instance().pop();  // the thread is exiting
+    if (!cache.head) Instance().refill(cache);
+    Slot* slot = cache.head;
+    cache.head = slot->next;
+    --cache.size;
+    return slot;
+  }
+
+  /// Return memory obtained from allocate() to the arena
+  static void deallocate(void* p) {
+    if (Destroyed()) return;  // the blocks were freed already
+    Slot* slot = static_cast<Slot*>(p);
+    LocalCache& cache = Local();
+    if (cache.closed) return Instance().push(slot);
+    slot->next = cache.head;
+    cache.head = slot;
+    if (++cache.size > 2 * BatchSize) Instance().release(cache, BatchSize);
+  }
+
+  enum { BatchSize = 64 };  ///< Number of slots moved between a thread and the shared list
+
+ private:
+  union Slot {
+    Slot* next;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  /// The free slots of one thread, trivially destructible so it stays usable at thread exit
+  struct LocalCache {
+    Slot* head;
+    size_t size;
+    bool closed;  ///< Set once the thread returned its slots, after which the lock is taken
+  };
+
+  /// Returns the slots of a thread to the shared list when the thread exits
+  struct LocalCacheRelease {
+    LocalCache& cache;
+    explicit LocalCacheRelease(LocalCache& cache) : cache(cache) {}
+    ~LocalCacheRelease() {
+      if (!Destroyed()) Instance().release(cache, 0);
+      cache.closed = true;
+    }
+  };
+
+  enum { InitialBlockSize = 64, MaxBlockSize = 65536 };
+
+  std::mutex mutex_;
+  Slot* free_;                 ///< Head of the shared list of free slots
+  size_t blockSize_;           ///< Number of slots in the next block
+  std::vector<void*> blocks_;  ///< Memory of all blocks, as returned by malloc
+
+  ValueArena() : free_(nullptr), blockSize_(InitialBlockSize) {}
+
+  ~ValueArena() {
+    Destroyed() = true;
+    for (void* block : blocks_)
+      std::free(block);
+  }
+
+  static ValueArena& Instance() {
+    static ValueArena instance;
+    return instance;
+  }
+
+  /// Set when the arena is destroyed at exit, a trivially destructible flag that outlives it
+  static bool& Destroyed() {
+    static bool destroyed = false;
+    return destroyed;
+  }
+
+  /// Allocate n slots, aligned by hand as malloc may align less than T requires. The memory
+  /// to free is stored in memory, or leaked if memory is null.
+  static Slot* allocateAligned(size_t n, void** memory) {
+    const size_t alignment = alignof(Slot);
+    void* raw = std::malloc(n * sizeof(Slot) + alignment);
+    if (!raw) throw std::bad_alloc();
+    if (memory) *memory = raw;
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw);
+    return reinterpret_cast<Slot*>((address + alignment - 1) / alignment * alignment);
+  }
+
+  static LocalCache& Local() {
+    static thread_local LocalCache cache = {nullptr, 0, false};
+    static thread_local LocalCacheRelease releaseAtExit(cache);
+    return cache;
+  }
+
+  void* pop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!free_) grow();
+    Slot* slot = free_;
+    free_ = slot->next;
+    return slot;
+  }
+
+  void push(Slot* slot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  /// Move up to BatchSize slots from the shared list to an empty thread list
+  void refill(LocalCache& cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!free_) grow();
+    Slot* last = free_;
+    size_t count = 1;
+    while (count < BatchSize && last->next) {
+      last = last->next;
+      ++count;
+    }
+    cache.head = free_;
+    cache.size = count;
+    free_ = last->next;
+    last->next = nullptr;
+  }
+
+  /// Keep the first, most recently freed, slots of a thread list and move the others to the
+  /// shared list
+  void release(LocalCache& cache, size_t keep) {
+    if (cache.size <= keep) return;
+    Slot* first = cache.head;
+    Slot* last = nullptr;
+    for (size_t i = 0; i < keep; ++i) {
+      last = first;
+      first = first->next;
+    }
+    Slot* tail = first;
+    while (tail->next)
+      tail = tail->next;
+    if (last)
+      last->next = nullptr;
+    else
+      cache.head = nullptr;
+    cache.size = keep;
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail->next = free_;
+    free_ = first;
+  }
+
+  void grow() {
+    blocks_.reserve(blocks_.size() + 1);  // so the block cannot leak if this throws
+    void* memory;
+    Slot* block = allocateAligned(blockSize_, &memory);
+    blocks_.push_back(memory);
+    for (size_t i = 0; i + 1 < blockSize_; ++i)
+      block[i].next = &block[i + 1];
+    block[blockSize_ - 1].next = nullptr;
+    free_ = block;
+    blockSize_ = std::min<size_t>(2 * blockSize_, MaxBlockSize);
+  }
+};
+
+}  // namespace internal
+}  // namespace gtsam
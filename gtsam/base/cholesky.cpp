@@ -19,10 +19,16 @@
 
 #include <gtsam/base/cholesky.h>
 #include <gtsam/base/timing.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
 
 #include <boost/format.hpp>
+#include <algorithm>
 #include <cmath>
 
+#ifdef GTSAM_USE_TBB
+#  include <tbb/parallel_for.h>
+#endif
+
 using namespace std;
 
 namespace gtsam {
@@ -32,6 +38,11 @@ static const double zeroPivotThreshold = 1e-6;
 static const double underconstrainedPrior = 1e-5;
 static const int underconstrainedExponentDifference = 12;
 
+// Problems with at least this many rows are factored in parallel, in panels of
+// parallelPanelWidth columns
+static const size_t parallelFactorizationThreshold = 512;
+static const size_t parallelPanelWidth = 64;
+
 /* ************************************************************************* */
 static inline int choleskyStep(Matrix& ATA, size_t k, size_t order) {
   // Get pivot value
@@ -104,6 +115,78 @@ pair<size_t, bool> choleskyCareful(Matrix& ATA, int order) {
   return make_pair(maxrank, success);
 }
 
+/* ************************************************************************* */
+// Check the last diagonal elements of the factor R - Eigen does not check them
+template <class MATRIX>
+static bool choleskyPivotsWellConditioned(const MATRIX& R) {
+  const Eigen::Index nFrontal = R.rows();
+  if (nFrontal >= 2) {
+    int exp2, exp1;
+    (void)frexp(R(nFrontal - 2, nFrontal - 2), &exp2);
+    (void)frexp(R(nFrontal - 1, nFrontal - 1), &exp1);
+    return (exp2 - exp1 < underconstrainedExponentDifference);
+  } else if (nFrontal == 1) {
+    int exp1;
+    (void)frexp(R(0, 0), &exp1);
+    return (exp1 > -underconstrainedExponentDifference);
+  } else {
+    return true;
+  }
+}
+
+#ifdef GTSAM_USE_TBB
+/* ************************************************************************* */
+// Call f(begin, end), in parallel, on consecutive column ranges of width
+// parallelPanelWidth covering [0, n)
+template <typename F>
+static void parallelForEachPanel(size_t n, const F& f) {
+  const size_t nrPanels = (n + parallelPanelWidth - 1) / parallelPanelWidth;
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, nrPanels),
+      [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t panel = range.begin(); panel != range.end(); ++panel)
+          f(panel * parallelPanelWidth, std::min(n, (panel + 1) * parallelPanelWidth));
+      });
+}
+
+/* ************************************************************************* */
+// Right-looking blocked version of the factorization in choleskyPartial: each
+// panel of frontal columns is factored serially, after which the rows to its
+// right and the trailing upper triangle are updated panel by panel, in parallel.
+static bool choleskyPartialBlocked(Matrix& ABC, size_t nFrontal, size_t topleft) {
+  gttic(choleskyPartialBlocked);
+  const size_t n = static_cast<size_t>(ABC.rows() - topleft);
+  for (size_t k = 0; k < nFrontal; k += parallelPanelWidth) {
+    const size_t width = std::min(parallelPanelWidth, nFrontal - k);
+    const size_t start = topleft + k, rest = n - k - width;
+
+    // Factor the diagonal block of the panel
+    auto A = ABC.block(start, start, width, width);
+    Eigen::LLT<Matrix, Eigen::Upper> llt(A);
+    if (llt.info() != Eigen::Success)
+      return false;
+    A.triangularView<Eigen::Upper>() = llt.matrixU();
+    if (rest == 0)
+      continue;
+
+    // Solve for the rows of the panel to the right of the diagonal block, and
+    // subtract their outer product from the upper triangle of the trailing matrix
+    const auto R = A.triangularView<Eigen::Upper>();
+    auto B = ABC.block(start, start + width, width, rest);
+    parallelForEachPanel(rest, [&](size_t begin, size_t end) {
+      auto Bj = B.middleCols(begin, end - begin);
+      R.transpose().solveInPlace(Bj);
+    });
+    parallelForEachPanel(rest, [&](size_t begin, size_t end) {
+      auto C = ABC.block(start + width, start + width + begin, end, end - begin);
+      C.topRows(begin).noalias() -= B.leftCols(begin).transpose() * B.middleCols(begin, end - begin);
+      C.bottomRows(end - begin).triangularView<Eigen::Upper>() -=
+          B.middleCols(begin, end - begin).transpose() * B.middleCols(begin, end - begin);
+    });
+  }
+  return true;
+}
+#endif
+
 /* ************************************************************************* */
 bool choleskyPartial(Matrix& ABC, size_t nFrontal, size_t topleft) {
   gttic(choleskyPartial);
@@ -115,6 +198,16 @@ bool choleskyPartial(Matrix& ABC, size_t nFrontal, size_t topleft) {
   const size_t n = static_cast<size_t>(ABC.rows() - topleft);
   assert(nFrontal <= size_t(n));
 
+#ifdef GTSAM_USE_TBB
+  // Large cliques, such as the root of a graph with many loop closures, would
+  // otherwise leave all but one thread idle at the end of elimination
+  if (n >= parallelFactorizationThreshold) {
+    if (!choleskyPartialBlocked(ABC, nFrontal, topleft))
+      return false;
+    return choleskyPivotsWellConditioned(ABC.block(topleft, topleft, nFrontal, nFrontal));
+  }
+#endif
+
   // Create views on blocks
   auto A = ABC.block(topleft, topleft, nFrontal, nFrontal);
   auto B = ABC.block(topleft, topleft + nFrontal, nFrontal, n - nFrontal);
@@ -143,18 +236,7 @@ bool choleskyPartial(Matrix& ABC, size_t nFrontal, size_t topleft) {
   gttoc(compute_L);
 
   // Check last diagonal element - Eigen does not check it
-  if (nFrontal >= 2) {
-    int exp2, exp1;
-    // NOTE(gareth): R is already the size of A, so we don't need to add topleft here.
-    (void)frexp(R(nFrontal - 2, nFrontal - 2), &exp2);
-    (void)frexp(R(nFrontal - 1, nFrontal - 1), &exp1);
-    return (exp2 - exp1 < underconstrainedExponentDifference);
-  } else if (nFrontal == 1) {
-    int exp1;
-    (void)frexp(R(0, 0), &exp1);
-    return (exp1 > -underconstrainedExponentDifference);
-  } else {
-    return true;
-  }
+  // NOTE(gareth): R is already the size of A, so we don't need to add topleft here.
+  return choleskyPivotsWellConditioned(A);
 }
 }  // namespace gtsam
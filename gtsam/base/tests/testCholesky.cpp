@@ -66,6 +66,34 @@ TEST(cholesky, choleskyPartial) {
   EXPECT(assert_equal(expected, actual, 1e-9));
 }
 
+/* ************************************************************************* */
+TEST(cholesky, choleskyPartialLarge) {
+  // Large enough to be factored in parallel panels when built with TBB
+  const size_t n = 600, nFrontal = 150;
+  const Matrix J = Matrix::Random(n + 10, n);
+  const Matrix ABC = (J.transpose() * J).triangularView<Eigen::Upper>();
+
+  Matrix RSL(ABC);
+  EXPECT(choleskyPartial(RSL, nFrontal));
+
+  // Compare with a dense factorization of the frontal block
+  const Matrix A = ABC.topLeftCorner(nFrontal, nFrontal);
+  const Matrix R = Eigen::LLT<Matrix, Eigen::Upper>(A.selfadjointView<Eigen::Upper>()).matrixU();
+  const Matrix S = R.transpose().triangularView<Eigen::Lower>().solve(
+      ABC.topRightCorner(nFrontal, n - nFrontal));
+  const Matrix L = ABC.bottomRightCorner(n - nFrontal, n - nFrontal)
+                       .selfadjointView<Eigen::Upper>().toDenseMatrix() - S.transpose() * S;
+  EXPECT(assert_equal(R, Matrix(RSL.topLeftCorner(nFrontal, nFrontal)), 1e-6));
+  EXPECT(assert_equal(S, Matrix(RSL.topRightCorner(nFrontal, n - nFrontal)), 1e-6));
+  EXPECT(assert_equal(Matrix(L.triangularView<Eigen::Upper>()),
+      Matrix(RSL.bottomRightCorner(n - nFrontal, n - nFrontal).triangularView<Eigen::Upper>()),
+      1e-6));
+
+  // The lower triangle is not touched
+  EXPECT(assert_equal(Matrix(ABC.triangularView<Eigen::StrictlyLower>()),
+                      Matrix(RSL.triangularView<Eigen::StrictlyLower>())));
+}
+
 /* ************************************************************************* */
 TEST(cholesky, BadScalingCholesky) {
   Matrix A = (Matrix(2,2) <<
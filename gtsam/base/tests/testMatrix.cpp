@@ -837,6 +837,18 @@ TEST(Matrix, eigen_QR )
   EXPECT(assert_equal(expected, A, 1e-3));
 }
 
+/* ************************************************************************* */
+TEST(Matrix, inplace_QR_large)
+{
+  // Large enough to update the trailing columns in parallel when built with TBB
+  const Matrix A = Matrix::Random(700, 600);
+  Matrix expected = A.householderQr().matrixQR();
+  zeroBelowDiagonal(expected);
+  Matrix actual = A;
+  inplace_QR(actual);
+  EXPECT(assert_equal(expected, actual, 1e-9));
+}
+
 /* ************************************************************************* */
 // unit test for qr factorization (and hence householder)
 // This behaves the same as QR in matlab: [Q,R] = qr(A), except for signs
@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testTiming.cpp
+ * @brief   Unit tests for the gttic/gttoc timing instrumentation
+ * @date    Oct 2026
+ */
+
+#include <gtsam/base/timing.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+  // Look up a child of a timing tree by label
+  boost::shared_ptr<internal::TimingOutline> child(
+      const boost::shared_ptr<internal::TimingOutline>& node, const char* label) {
+    return node->child(internal::getTicTocID(label), label, node);
+  }
+
+  void work(size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      gttic_(timingTestOuter);
+      gttic_(timingTestInner);
+      gttoc_(timingTestInner);
+    }
+  }
+}
+
+/* ************************************************************************* */
+TEST(Timing, wallClock) {
+  EXPECT(internal::secondsPerWallTick() > 0.0);
+  const uint64_t start = internal::wallTicks();
+  this_thread::sleep_for(chrono::milliseconds(20));
+  const double elapsed = double(internal::wallTicks() - start) * internal::secondsPerWallTick();
+  EXPECT(elapsed > 0.015);
+  EXPECT(elapsed < 1.0);
+}
+
+/* ************************************************************************* */
+TEST(Timing, nesting) {
+  tictoc_reset_();
+  {
+    gttic_(timingTestSleep);
+    this_thread::sleep_for(chrono::milliseconds(20));
+  }
+  work(3);
+
+  const boost::shared_ptr<internal::TimingOutline> merged = internal::mergedTimingTree();
+  EXPECT_LONGS_EQUAL(1, child(merged, "timingTestSleep")->count());
+  EXPECT(child(merged, "timingTestSleep")->wall() > 0.015);
+  EXPECT_LONGS_EQUAL(3, child(merged, "timingTestOuter")->count());
+  EXPECT_LONGS_EQUAL(3, child(child(merged, "timingTestOuter"), "timingTestInner")->count());
+  tictoc_reset_();
+}
+
+/* ************************************************************************* */
+TEST(Timing, threads) {
+  tictoc_reset_();
+  {
+    // Threads time into their own trees, even while the main thread has a section open
+    gttic_(timingTestMain);
+    vector<thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+      threads.push_back(thread(work, 10));
+    for (thread& t : threads)
+      t.join();
+  }
+  work(1);
+
+  // The trees are merged by label
+  const boost::shared_ptr<internal::TimingOutline> merged = internal::mergedTimingTree();
+  EXPECT_LONGS_EQUAL(1, child(merged, "timingTestMain")->count());
+  EXPECT_LONGS_EQUAL(41, child(merged, "timingTestOuter")->count());
+  EXPECT_LONGS_EQUAL(41, child(child(merged, "timingTestOuter"), "timingTestInner")->count());
+
+  // After a reset, the trees of the other threads are gone
+  tictoc_reset_();
+  EXPECT_LONGS_EQUAL(0, child(internal::mergedTimingTree(), "timingTestOuter")->count());
+}
+
+/* ************************************************************************* */
+TEST(Timing, currentTimerOfMainThread) {
+  // gCurrentTimer still follows the timers of the main thread
+  tictoc_reset_();
+  EXPECT(internal::gCurrentTimer.lock() == internal::gTimingRoot);
+  {
+    gttic_(timingTestMain);
+    EXPECT(internal::gCurrentTimer.lock() == child(internal::gTimingRoot, "timingTestMain"));
+    EXPECT(internal::gCurrentTimer.lock() == internal::currentTimer().lock());
+  }
+  EXPECT(internal::gCurrentTimer.lock() == internal::gTimingRoot);
+  tictoc_reset_();
+}
+
+/* ************************************************************************* */
+namespace {
+  size_t count(const string& text, const string& pattern) {
+    size_t n = 0;
+    for (size_t pos = text.find(pattern); pos != string::npos; pos = text.find(pattern, pos + 1))
+      ++n;
+    return n;
+  }
+}
+
+/* ************************************************************************* */
+TEST(Timing, chromeTrace) {
+  tictoc_reset_();
+  work(1); // not recorded
+  tictoc_startRecording_();
+  work(2);
+  tictoc_finishedIteration_();
+  thread worker(work, 1);
+  worker.join();
+  tictoc_stopRecording_();
+  work(1); // not recorded
+
+  stringstream trace;
+  tictoc_writeChromeTrace_(trace);
+  const string json = trace.str();
+  EXPECT_LONGS_EQUAL(0, json.find("{\"traceEvents\":["));
+  EXPECT_LONGS_EQUAL(2, count(json, "\"ph\":\"M\""));
+  EXPECT_LONGS_EQUAL(3, count(json, "\"name\":\"timingTestOuter\",\"ph\":\"B\""));
+  EXPECT_LONGS_EQUAL(3, count(json, "\"name\":\"timingTestInner\",\"ph\":\"E\""));
+  EXPECT_LONGS_EQUAL(8, count(json, "\"iteration\":0"));
+  EXPECT_LONGS_EQUAL(4, count(json, "\"tid\":1,\"args\":{\"iteration\":1}"));
+
+  // With a small buffer, only the last events are kept and unmatched ends are dropped
+  tictoc_startRecording_(3);
+  work(2);
+  tictoc_stopRecording_();
+  stringstream lastEvents;
+  tictoc_writeChromeTrace_(lastEvents);
+  EXPECT_LONGS_EQUAL(0, count(lastEvents.str(), "\"tid\":1,\"args\":{\"iteration\""));
+  EXPECT_LONGS_EQUAL(1, count(lastEvents.str(), "\"ph\":\"B\""));
+  EXPECT_LONGS_EQUAL(1, count(lastEvents.str(), "\"ph\":\"E\""));
+  tictoc_reset_();
+}
+
+/* ************************************************************************* */
+TEST(Timing, collapsedStacks) {
+  tictoc_reset_();
+  {
+    gttic_(timingTestSleep);
+    this_thread::sleep_for(chrono::milliseconds(20));
+  }
+  stringstream stacks;
+  tictoc_writeCollapsedStacks_(stacks);
+  string label;
+  size_t usecs = 0;
+  stacks >> label >> usecs;
+  EXPECT(label == "timingTestSleep");
+  EXPECT(usecs > 15000);
+  tictoc_reset_();
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
+/* ************************************************************************* */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testValueArena.cpp
+ * @date Oct 2026
+ * @brief unit tests for the per-type arenas of Values
+ */
+
+#include <gtsam/base/ValueArena.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Each test uses its own type, so that it starts with an empty arena
+template <int I>
+struct alignas(32) Slot {
+  double data[5];
+};
+}
+
+/* ************************************************************************* */
+TEST(ValueArena, Reuse) {
+  typedef internal::ValueArena<Slot<0> > Arena;
+  void* first = Arena::allocate();
+  EXPECT_LONGS_EQUAL(0, reinterpret_cast<size_t>(first) % 32);
+  Arena::deallocate(first);
+  void* second = Arena::allocate();
+  EXPECT(first == second);
+  Arena::deallocate(second);
+}
+
+/* ************************************************************************* */
+TEST(ValueArena, ManySlots) {
+  // More slots than a thread keeps, so they go through the shared list
+  typedef internal::ValueArena<Slot<1> > Arena;
+  const size_t n = 10 * Arena::BatchSize;
+  vector<void*> slots;
+  for (size_t i = 0; i < n; ++i) {
+    slots.push_back(Arena::allocate());
+    EXPECT_LONGS_EQUAL(0, reinterpret_cast<size_t>(slots.back()) % 32);
+  }
+  const set<void*> distinct(slots.begin(), slots.end());
+  EXPECT_LONGS_EQUAL(n, distinct.size());
+
+  // Freed slots are handed out again before the arena grows
+  for (void* slot : slots)
+    Arena::deallocate(slot);
+  for (size_t i = 0; i < n; ++i)
+    slots[i] = Arena::allocate();
+  EXPECT_LONGS_EQUAL(n, set<void*>(slots.begin(), slots.end()).size());
+  for (void* slot : slots)
+    EXPECT(distinct.count(slot));
+  for (void* slot : slots)
+    Arena::deallocate(slot);
+}
+
+/* ************************************************************************* */
+TEST(ValueArena, Threads) {
+  // Slots are allocated in one thread and freed in another, as when a Values is built in
+  // parallel and destroyed by the caller
+  typedef internal::ValueArena<Slot<2> > Arena;
+  const size_t nrThreads = 4, n = 5 * Arena::BatchSize;
+  vector<vector<void*> > slots(nrThreads);
+  vector<thread> threads;
+  for (size_t t = 0; t < nrThreads; ++t)
+    threads.emplace_back([&slots, t, n]() {
+      for (size_t i = 0; i < n; ++i) {
+        slots[t].push_back(Arena::allocate());
+        static_cast<Slot<2>*>(slots[t].back())->data[0] = double(t);
+      }
+    });
+  for (thread& thread : threads) thread.join();
+
+  set<void*> distinct;
+  for (size_t t = 0; t < nrThreads; ++t)
+    for (void* slot : slots[t]) {
+      EXPECT_DOUBLES_EQUAL(double(t), static_cast<Slot<2>*>(slot)->data[0], 0.0);
+      distinct.insert(slot);
+    }
+  EXPECT_LONGS_EQUAL(nrThreads * n, distinct.size());
+
+  threads.clear();
+  for (size_t t = 0; t < nrThreads; ++t)
+    threads.emplace_back([&slots, t, nrThreads]() {
+      for (void* slot : slots[(t + 1) % nrThreads])
+        Arena::deallocate(slot);
+    });
+  for (thread& thread : threads) thread.join();
+
+  // The slots of the exited threads are all available again
+  vector<void*> reused;
+  for (size_t i = 0; i < nrThreads * n; ++i) {
+    reused.push_back(Arena::allocate());
+    EXPECT(distinct.count(reused.back()));
+  }
+  EXPECT_LONGS_EQUAL(nrThreads * n, set<void*>(reused.begin(), reused.end()).size());
+  for (void* slot : reused)
+    Arena::deallocate(slot);
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
+/* ************************************************************************* */
@@ -21,31 +21,180 @@
 
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/format.hpp>
+#include <boost/make_shared.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <cassert>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <ostream>
 #include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  else
+#    include <x86intrin.h>
+#  endif
+#  define GTSAM_TIMING_USE_TSC
+#endif
 
 namespace gtsam {
 namespace internal {
 
+namespace {
+typedef std::chrono::steady_clock SteadyClock;
+
+// Reference points for calibrating the time stamp counter against the steady clock
+const uint64_t gStartTicks = wallTicks();
+const SteadyClock::time_point gStartTime = SteadyClock::now();
+
+// The thread that loaded the library times into gTimingRoot
+const std::thread::id gMainThread = std::this_thread::get_id();
+
+// Trees of the other threads, kept after the threads exit so they can still be printed. A thread
+// only takes the lock when it first times something after a reset.
+std::mutex gThreadRootsMutex;
+std::vector<boost::shared_ptr<TimingOutline> > gThreadRoots;
+
+// Incremented on reset, so threads know to start a new tree
+std::atomic<size_t> gGeneration(0);
+uint64_t gGenerationStartTicks = gStartTicks;
+
+// Number of finished iterations since the last reset
+std::atomic<size_t> gIteration(0);
+
+// A gttic or gttoc, recorded while recording is on
+struct TimingEvent {
+  const char* label;
+  size_t iteration;
+  uint64_t ticks;
+  bool begin;
+};
+
+// Ring buffer with the last events of a thread
+struct EventBuffer {
+  std::vector<TimingEvent> events;
+  size_t nrEvents; ///< number of events recorded, only the last events.size() are kept
+  EventBuffer() : nrEvents(0) {}
+};
+
+// Number of events kept per thread, zero if not recording
+std::atomic<size_t> gEventCapacity(0);
+
+// Event buffers of all threads, the one of the main thread first and the others in the order of
+// gThreadRoots. Guarded by gThreadRootsMutex, like gThreadRoots.
+std::vector<boost::shared_ptr<EventBuffer> > gEventBuffers(1,
+    boost::make_shared<EventBuffer>());
+
+struct ThreadTimers {
+  size_t generation;
+  boost::shared_ptr<TimingOutline> root;
+  boost::weak_ptr<TimingOutline>* current; ///< gCurrentTimer in the main thread, else ownCurrent
+  boost::weak_ptr<TimingOutline> ownCurrent;
+  boost::shared_ptr<EventBuffer> events;
+  ThreadTimers() : generation(size_t(-1)), current(&ownCurrent) {}
+};
+thread_local ThreadTimers gThreadTimers;
+}
+
 GTSAM_EXPORT boost::shared_ptr<TimingOutline> gTimingRoot(
     new TimingOutline("Total", getTicTocID("Total")));
-GTSAM_EXPORT boost::weak_ptr<TimingOutline> gCurrentTimer(gTimingRoot);
+GTSAM_EXPORT boost::weak_ptr<TimingOutline> gCurrentTimer;
+
+/* ************************************************************************* */
+// Timers of the calling thread, starting a new tree after a reset
+static ThreadTimers& threadTimers() {
+  ThreadTimers& timers = gThreadTimers;
+  const size_t generation = gGeneration.load();
+  if (timers.generation != generation) {
+    std::lock_guard<std::mutex> lock(gThreadRootsMutex);
+    if (std::this_thread::get_id() == gMainThread) {
+      timers.root = gTimingRoot;
+      timers.current = &gCurrentTimer;
+      timers.events = gEventBuffers.front();
+    } else {
+      timers.root.reset(new TimingOutline("Total", getTicTocID("Total")));
+      gThreadRoots.push_back(timers.root);
+      timers.events = boost::make_shared<EventBuffer>();
+      gEventBuffers.push_back(timers.events);
+    }
+    *timers.current = timers.root;
+    timers.generation = generation;
+  }
+  return timers;
+}
+
+/* ************************************************************************* */
+// Add an event to the ring buffer of the calling thread, if recording
+static void recordEvent(ThreadTimers& timers, const char* label, bool begin) {
+  const size_t capacity = gEventCapacity.load(std::memory_order_relaxed);
+  if (capacity == 0)
+    return;
+  EventBuffer& buffer = *timers.events;
+  if (buffer.events.size() != capacity) {
+    buffer.events.resize(capacity);
+    buffer.nrEvents = 0;
+  }
+  TimingEvent& event = buffer.events[buffer.nrEvents % capacity];
+  event.label = label;
+  event.iteration = gIteration.load(std::memory_order_relaxed);
+  event.ticks = wallTicks();
+  event.begin = begin;
+  ++buffer.nrEvents;
+}
+
+/* ************************************************************************* */
+uint64_t wallTicks() {
+#ifdef GTSAM_TIMING_USE_TSC
+  return __rdtsc();
+#else
+  return uint64_t(SteadyClock::now().time_since_epoch().count());
+#endif
+}
+
+/* ************************************************************************* */
+#ifdef GTSAM_TIMING_USE_TSC
+// Calibrate the time stamp counter over the run so far, but over at least a few milliseconds
+static double calibrateWallTicks() {
+  const SteadyClock::duration minimum = std::chrono::milliseconds(10);
+  const SteadyClock::duration elapsed = SteadyClock::now() - gStartTime;
+  if (elapsed < minimum)
+    std::this_thread::sleep_for(minimum - elapsed);
+  const SteadyClock::time_point now = SteadyClock::now();
+  const uint64_t ticks = wallTicks();
+  return std::chrono::duration<double>(now - gStartTime).count() / double(ticks - gStartTicks);
+}
+#endif
+
+/* ************************************************************************* */
+double secondsPerWallTick() {
+#ifdef GTSAM_TIMING_USE_TSC
+  // Calibrated once, on first use, so all reported times use the same factor
+  static const double secondsPerTick = calibrateWallTicks();
+  return secondsPerTick;
+#else
+  return double(SteadyClock::period::num) / double(SteadyClock::period::den);
+#endif
+}
 
 /* ************************************************************************* */
 // Implementation of TimingOutline
 /* ************************************************************************* */
 
 /* ************************************************************************* */
-void TimingOutline::add(size_t usecs, size_t usecsWall) {
+void TimingOutline::add(size_t usecs, uint64_t ticksWall) {
   t_ += usecs;
-  tWall_ += usecsWall;
+  tWall_ += ticksWall;
   tIt_ += usecs;
   double secs = (double(usecs) / 1000000.0);
   t2_ += secs * secs;
@@ -55,7 +204,7 @@ void TimingOutline::add(size_t usecs, size_t usecsWall) {
 /* ************************************************************************* */
 TimingOutline::TimingOutline(const std::string& label, size_t id) :
     id_(id), t_(0), tWall_(0), t2_(0.0), tIt_(0), tMax_(0), tMin_(0), n_(0), myOrder_(
-        0), lastChildOrder_(0), label_(label) {
+        0), lastChildOrder_(0), label_(label), wallStart_(0) {
 #ifdef GTSAM_USING_NEW_BOOST_TIMERS
   timer_.stop();
 #endif
@@ -166,9 +315,7 @@ void TimingOutline::tic() {
   *timerActive_ = true;
 #endif
 
-#ifdef GTSAM_USE_TBB
-  tbbTimer_ = tbb::tick_count::now();
-#endif
+  wallStart_ = wallTicks();
 }
 
 /* ************************************************************************* */
@@ -178,9 +325,6 @@ void TimingOutline::toc() {
   assert(!timer_.is_stopped());
   timer_.stop();
   size_t cpuTime = (timer_.elapsed().user + timer_.elapsed().system) / 1000;
-#  ifndef GTSAM_USE_TBB
-  size_t wallTime = timer_.elapsed().wall / 1000;
-#  endif
 
 #else
 
@@ -188,18 +332,10 @@ void TimingOutline::toc() {
   double elapsed = timer_.elapsed();
   size_t cpuTime = size_t(elapsed * 1000000.0);
   *timerActive_ = false;
-#  ifndef GTSAM_USE_TBB
-  size_t wallTime = cpuTime;
-#  endif
-
-#endif
 
-#ifdef GTSAM_USE_TBB
-  size_t wallTime = size_t(
-      (tbb::tick_count::now() - tbbTimer_).seconds() * 1e6);
 #endif
 
-  add(cpuTime, wallTime);
+  add(cpuTime, wallTicks() - wallStart_);
 }
 
 /* ************************************************************************* */
@@ -214,12 +350,61 @@ void TimingOutline::finishedIteration() {
   }
 }
 
+/* ************************************************************************* */
+void TimingOutline::merge(const TimingOutline& other,
+    const boost::weak_ptr<TimingOutline>& thisPtr) {
+  assert(thisPtr.lock().get() == this);
+  t_ += other.t_;
+  tWall_ += other.tWall_;
+  t2_ += other.t2_;
+  tIt_ += other.tIt_;
+  n_ += other.n_;
+  tMax_ = std::max(tMax_, other.tMax_);
+  if (tMin_ == 0 || (other.tMin_ != 0 && other.tMin_ < tMin_))
+    tMin_ = other.tMin_;
+  // Merge children in the order they were created in the other tree
+  typedef std::map<size_t, boost::shared_ptr<TimingOutline> > ChildOrder;
+  ChildOrder childOrder;
+  for(const ChildMap::value_type& child: other.children_)
+    childOrder[child.second->myOrder_] = child.second;
+  for(const ChildOrder::value_type& order_child: childOrder) {
+    const TimingOutline& otherChild = *order_child.second;
+    const boost::shared_ptr<TimingOutline>& myChild =
+        child(otherChild.id_, otherChild.label_, thisPtr);
+    myChild->merge(otherChild, myChild);
+  }
+}
+
+/* ************************************************************************* */
+void TimingOutline::writeCollapsedStacks(std::ostream& os,
+    const std::string& stack) const {
+  typedef std::map<size_t, boost::shared_ptr<TimingOutline> > ChildOrder;
+  ChildOrder childOrder;
+  for(const ChildMap::value_type& child: children_)
+    childOrder[child.second->myOrder_] = child.second;
+  for(const ChildOrder::value_type& order_child: childOrder) {
+    const TimingOutline& child = *order_child.second;
+    const std::string childStack = stack.empty() ? child.label_ : stack + ";" + child.label_;
+    // Self time is the wall time not spent in the children
+    uint64_t childrenTicks = 0;
+    for(const ChildMap::value_type& grandChild: child.children_)
+      childrenTicks += grandChild.second->tWall_;
+    const double selfTicks = double(child.tWall_) - double(childrenTicks);
+    const uint64_t usecs = uint64_t(std::max(selfTicks * secondsPerWallTick() * 1e6, 0.0));
+    if (usecs > 0)
+      os << childStack << " " << usecs << "\n";
+    child.writeCollapsedStacks(os, childStack);
+  }
+}
+
 /* ************************************************************************* */
 size_t getTicTocID(const char *descriptionC) {
   const std::string description(descriptionC);
   // Global (static) map from strings to ID numbers and current next ID number
+  static std::mutex idMapMutex;
   static size_t nextId = 0;
   static gtsam::FastMap<std::string, size_t> idMap;
+  std::lock_guard<std::mutex> lock(idMapMutex);
 
   // Retrieve or add this string
   gtsam::FastMap<std::string, size_t>::const_iterator it = idMap.find(
@@ -236,31 +421,157 @@ size_t getTicTocID(const char *descriptionC) {
 /* ************************************************************************* */
 void tic(size_t id, const char *labelC) {
   const std::string label(labelC);
+  ThreadTimers& timers = threadTimers();
   boost::shared_ptr<TimingOutline> node = //
-      gCurrentTimer.lock()->child(id, label, gCurrentTimer);
-  gCurrentTimer = node;
+      timers.current->lock()->child(id, label, *timers.current);
+  *timers.current = node;
   node->tic();
+  recordEvent(timers, labelC, true);
 }
 
 /* ************************************************************************* */
 void toc(size_t id, const char *label) {
-  boost::shared_ptr<TimingOutline> current(gCurrentTimer.lock());
+  ThreadTimers& timers = threadTimers();
+  boost::shared_ptr<TimingOutline> current(timers.current->lock());
   if (id != current->id_) {
-    gTimingRoot->print();
+    timers.root->print();
     throw std::invalid_argument(
         (boost::format(
             "gtsam timing:  Mismatched tic/toc: gttoc(\"%s\") called when last tic was \"%s\".")
             % label % current->label_).str());
   }
   if (!current->parent_.lock()) {
-    gTimingRoot->print();
+    timers.root->print();
     throw std::invalid_argument(
         (boost::format(
             "gtsam timing:  Mismatched tic/toc: extra gttoc(\"%s\"), already at the root")
             % label).str());
   }
   current->toc();
-  gCurrentTimer = current->parent_;
+  *timers.current = current->parent_;
+  recordEvent(timers, label, false);
+}
+
+/* ************************************************************************* */
+const boost::shared_ptr<TimingOutline>& threadTimingRoot() {
+  return threadTimers().root;
+}
+
+/* ************************************************************************* */
+const boost::weak_ptr<TimingOutline>& currentTimer() {
+  return *threadTimers().current;
+}
+
+/* ************************************************************************* */
+boost::shared_ptr<TimingOutline> mergedTimingTree() {
+  boost::shared_ptr<TimingOutline> merged(
+      new TimingOutline("Total", getTicTocID("Total")));
+  std::lock_guard<std::mutex> lock(gThreadRootsMutex);
+  merged->merge(*gTimingRoot, merged);
+  for(const boost::shared_ptr<TimingOutline>& root: gThreadRoots)
+    merged->merge(*root, merged);
+  return merged;
+}
+
+/* ************************************************************************* */
+void finishedIteration() {
+  std::lock_guard<std::mutex> lock(gThreadRootsMutex);
+  gTimingRoot->finishedIteration();
+  for(const boost::shared_ptr<TimingOutline>& root: gThreadRoots)
+    root->finishedIteration();
+  ++gIteration;
+}
+
+/* ************************************************************************* */
+void printThreadTimings() {
+  std::lock_guard<std::mutex> lock(gThreadRootsMutex);
+  if (gThreadRoots.empty())
+    return;
+  const double secondsPerTick = secondsPerWallTick();
+  const double total = double(wallTicks() - gGenerationStartTicks) * secondsPerTick;
+  std::cout << "Threads (" << total << " wall since reset):\n";
+  for (size_t i = 0; i <= gThreadRoots.size(); ++i) {
+    // Busy time is the time spent in the top-level sections of the thread
+    const TimingOutline& root = i == 0 ? *gTimingRoot : *gThreadRoots[i - 1];
+    uint64_t busyTicks = 0;
+    for(const TimingOutline::ChildMap::value_type& child: root.children_)
+      busyTicks += child.second->tWall_;
+    const double busy = double(busyTicks) * secondsPerTick;
+    std::cout << "|   -" << (i == 0 ? std::string("main") : "thread " + std::to_string(i))
+        << ": " << busy << " busy, " << std::max(total - busy, 0.0) << " idle\n";
+  }
+  std::cout.flush();
+}
+
+/* ************************************************************************* */
+void resetTimings() {
+  std::lock_guard<std::mutex> lock(gThreadRootsMutex);
+  gTimingRoot.reset(new TimingOutline("Total", getTicTocID("Total")));
+  gCurrentTimer = gTimingRoot;
+  gThreadRoots.clear();
+  gEventBuffers.assign(1, boost::make_shared<EventBuffer>());
+  gGenerationStartTicks = wallTicks();
+  gIteration = 0;
+  ++gGeneration;
+}
+
+/* ************************************************************************* */
+void startRecording(size_t capacity) {
+  std::lock_guard<std::mutex> lock(gThreadRootsMutex);
+  for(const boost::shared_ptr<EventBuffer>& buffer: gEventBuffers) {
+    buffer->events.clear();
+    buffer->nrEvents = 0;
+  }
+  gEventCapacity = capacity;
+}
+
+/* ************************************************************************* */
+void stopRecording() {
+  gEventCapacity = 0;
+}
+
+/* ************************************************************************* */
+void writeChromeTrace(std::ostream& os) {
+  std::lock_guard<std::mutex> lock(gThreadRootsMutex);
+  const double usecsPerTick = secondsPerWallTick() * 1e6;
+  const std::ios::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+  os << "{\"traceEvents\":[";
+  const char* separator = "\n";
+  for (size_t i = 0; i < gEventBuffers.size(); ++i) {
+    os << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i
+       << ",\"args\":{\"name\":\""
+       << (i == 0 ? std::string("main") : "thread " + std::to_string(i)) << "\"}}";
+    separator = ",\n";
+
+    // Only the last events are kept, skip the ends of sections whose begin was overwritten
+    const EventBuffer& buffer = *gEventBuffers[i];
+    const size_t capacity = buffer.events.size();
+    const size_t first = buffer.nrEvents > capacity ? buffer.nrEvents - capacity : 0;
+    size_t depth = 0;
+    for (size_t k = first; k < buffer.nrEvents; ++k) {
+      const TimingEvent& event = buffer.events[k % capacity];
+      if (event.begin)
+        ++depth;
+      else if (depth == 0)
+        continue;
+      else
+        --depth;
+      const double usecs = double(int64_t(event.ticks - gGenerationStartTicks)) * usecsPerTick;
+      os << separator << "{\"name\":\"" << event.label << "\",\"ph\":\""
+         << (event.begin ? "B" : "E") << "\",\"ts\":" << std::fixed << std::setprecision(3)
+         << usecs << ",\"pid\":0,\"tid\":" << i << ",\"args\":{\"iteration\":"
+         << event.iteration << "}}";
+    }
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+/* ************************************************************************* */
+void writeCollapsedStacks(std::ostream& os) {
+  mergedTimingTree()->writeCollapsedStacks(os);
 }
 
 } // namespace internal
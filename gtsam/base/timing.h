@@ -26,6 +26,8 @@
 #include <boost/version.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <iosfwd>
 #include <string>
 
 // This file contains the GTSAM timing instrumentation library, a low-overhead method for
@@ -105,6 +107,25 @@
 //   too scope.  Note that if you use these, it may become difficult to ensure that you
 //   have matching gttic/gttoc statments.  You may want to consider reorganizing your timing
 //   outline to match the scope of your code.
+//
+// - Recording events.  The outline only keeps statistics per label, which averages away
+//   spikes in individual iterations.  Between tictoc_startRecording_ and tictoc_stopRecording_
+//   every gttic and gttoc is also logged with its thread, time and iteration number (counted
+//   by tictoc_finishedIteration_) into a ring buffer per thread.  tictoc_writeChromeTrace_
+//   writes the events in the Chrome Trace Event format, which can be viewed in
+//   chrome://tracing or https://ui.perfetto.dev.  tictoc_writeCollapsedStacks_ writes the
+//   wall time of the outline in the collapsed stack format read by flamegraph.pl.
+//
+// - Timing in multiple threads.  Every thread times into its own tree, so gttic/gttoc can be
+//   used inside parallel code, e.g. TBB tasks.  The tree of the main thread is the one the
+//   sections of the main thread nest in, the trees of the other threads start at their first
+//   gttic.  tictoc_print_ and tictoc_print2_ merge the trees of all threads by label and
+//   tictoc_print_ additionally reports how long each thread spent inside and outside of timed
+//   sections.  Printing, resetting and finishing iterations read and modify the trees of all
+//   threads, so they should only be called while no other thread is timing.
+//
+// Wall times are measured with the time stamp counter where available (x86), which is much
+// cheaper to read than the system clocks, and are converted to seconds when printing.
 
 // Automatically use the new Boost timers if version is recent enough.
 #if BOOST_VERSION >= 104800
@@ -120,25 +141,26 @@
 #  include <gtsam/base/types.h>
 #endif
 
-#ifdef GTSAM_USE_TBB
-#  include <tbb/tick_count.h>
-#  undef min
-#  undef max
-#  undef ERROR
-#endif
-
 namespace gtsam {
 
   namespace internal {
     // Generate/retrieve a unique global ID number that will be used to look up tic/toc statements
     GTSAM_EXPORT size_t getTicTocID(const char *description);
 
-    // Create new TimingOutline child for gCurrentTimer, make it gCurrentTimer, and call tic method
+    // Create new TimingOutline child for the current timer of this thread, make it the current
+    // timer, and call tic method
     GTSAM_EXPORT void tic(size_t id, const char *label);
 
-    // Call toc on gCurrentTimer and then set gCurrentTimer to the parent of gCurrentTimer
+    // Call toc on the current timer of this thread and then make its parent the current timer
     GTSAM_EXPORT void toc(size_t id, const char *label);
 
+    // Read the wall clock used for timing, in ticks of the time stamp counter where available
+    GTSAM_EXPORT uint64_t wallTicks();
+
+    // Duration of one wallTicks() tick, in seconds. With the time stamp counter, it is
+    // calibrated once on the first call, which may wait up to 10 ms after the library is loaded.
+    GTSAM_EXPORT double secondsPerWallTick();
+
     /**
      * Timing Entry, arranged in a tree
      */
@@ -146,7 +168,7 @@ namespace gtsam {
     protected:
       size_t id_;
       size_t t_;
-      size_t tWall_;
+      uint64_t tWall_; ///< in wallTicks()
       double t2_ ; ///< cache the \sum t_i^2
       size_t tIt_;
       size_t tMax_;
@@ -167,10 +189,8 @@ namespace gtsam {
       boost::timer timer_;
       gtsam::ValueWithDefault<bool,false> timerActive_;
 #endif
-#ifdef GTSAM_USE_TBB
-      tbb::tick_count tbbTimer_;
-#endif
-      void add(size_t usecs, size_t usecsWall);
+      uint64_t wallStart_; ///< wallTicks() at the last tic
+      void add(size_t usecs, uint64_t ticksWall);
 
     public:
       /// Constructor
@@ -178,10 +198,11 @@ namespace gtsam {
       GTSAM_EXPORT size_t time() const; ///< time taken, including children
       double secs() const { return double(time()) / 1000000.0;} ///< time taken, in seconds, including children
       double self() const { return double(t_)     / 1000000.0;} ///< self time only, in seconds
-      double wall() const { return double(tWall_) / 1000000.0;} ///< wall time, in seconds
+      double wall() const { return double(tWall_) * secondsPerWallTick();} ///< wall time, in seconds
       double min()  const { return double(tMin_)  / 1000000.0;} ///< min time, in seconds
       double max()  const { return double(tMax_)  / 1000000.0;} ///< max time, in seconds
       double mean() const { return self() / double(n_); } ///< mean self time, in seconds
+      size_t count() const { return n_; } ///< number of times timed
       GTSAM_EXPORT void print(const std::string& outline = "") const;
       GTSAM_EXPORT void print2(const std::string& outline = "", const double parentTotal = -1.0) const;
       GTSAM_EXPORT const boost::shared_ptr<TimingOutline>&
@@ -189,8 +210,13 @@ namespace gtsam {
       GTSAM_EXPORT void tic();
       GTSAM_EXPORT void toc();
       GTSAM_EXPORT void finishedIteration();
+      /// Add the statistics of another tree to this one, matching children by id
+      GTSAM_EXPORT void merge(const TimingOutline& other, const boost::weak_ptr<TimingOutline>& thisPtr);
+      /// Write the self wall time of every descendant in collapsed stack format
+      GTSAM_EXPORT void writeCollapsedStacks(std::ostream& os, const std::string& stack = "") const;
 
       GTSAM_EXPORT friend void toc(size_t id, const char *label);
+      GTSAM_EXPORT friend void printThreadTimings();
     }; // \TimingOutline
 
     /**
@@ -216,8 +242,42 @@ namespace gtsam {
       }
     };
 
+    // Timing tree of the main thread
     GTSAM_EXTERN_EXPORT boost::shared_ptr<TimingOutline> gTimingRoot;
+
+    // Innermost running timer of the main thread, kept for compatibility. Other threads have
+    // their own, see currentTimer().
     GTSAM_EXTERN_EXPORT boost::weak_ptr<TimingOutline> gCurrentTimer;
+
+    // Timing tree of the calling thread, gTimingRoot in the main thread
+    GTSAM_EXPORT const boost::shared_ptr<TimingOutline>& threadTimingRoot();
+
+    // Innermost running timer of the calling thread
+    GTSAM_EXPORT const boost::weak_ptr<TimingOutline>& currentTimer();
+
+    // Merge the timing trees of all threads into a new tree
+    GTSAM_EXPORT boost::shared_ptr<TimingOutline> mergedTimingTree();
+
+    // Call finishedIteration on the timing trees of all threads
+    GTSAM_EXPORT void finishedIteration();
+
+    // Print the wall time each thread spent inside and outside of timed sections
+    GTSAM_EXPORT void printThreadTimings();
+
+    // Discard the timing trees and recorded events of all threads
+    GTSAM_EXPORT void resetTimings();
+
+    // Start recording gttic/gttoc events, keeping the last capacity events of every thread
+    GTSAM_EXPORT void startRecording(size_t capacity);
+
+    // Stop recording events, the events recorded so far are kept
+    GTSAM_EXPORT void stopRecording();
+
+    // Write the recorded events in the Chrome Trace Event format
+    GTSAM_EXPORT void writeChromeTrace(std::ostream& os);
+
+    // Write mergedTimingTree() in the collapsed stack format
+    GTSAM_EXPORT void writeCollapsedStacks(std::ostream& os);
   }
 
 // Tic and toc functions that are always active (whether or not ENABLE_TIMING is defined)
@@ -247,26 +307,42 @@ namespace gtsam {
 
 // indicate iteration is finished
 inline void tictoc_finishedIteration_() {
-  ::gtsam::internal::gTimingRoot->finishedIteration(); }
+  ::gtsam::internal::finishedIteration(); }
 
 // print
 inline void tictoc_print_() {
-  ::gtsam::internal::gTimingRoot->print(); }
+  ::gtsam::internal::mergedTimingTree()->print();
+  ::gtsam::internal::printThreadTimings(); }
 
 // print mean and standard deviation
 inline void tictoc_print2_() {
-  ::gtsam::internal::gTimingRoot->print2(); }
+  ::gtsam::internal::mergedTimingTree()->print2(); }
 
 // get a node by label and assign it to variable
 #define tictoc_getNode(variable, label) \
   static const size_t label##_id_getnode = ::gtsam::internal::getTicTocID(#label); \
   const boost::shared_ptr<const ::gtsam::internal::TimingOutline> variable = \
-  ::gtsam::internal::gCurrentTimer.lock()->child(label##_id_getnode, #label, ::gtsam::internal::gCurrentTimer);
+  ::gtsam::internal::currentTimer().lock()->child(label##_id_getnode, #label, ::gtsam::internal::currentTimer());
 
 // reset
 inline void tictoc_reset_() {
-  ::gtsam::internal::gTimingRoot.reset(new ::gtsam::internal::TimingOutline("Total", ::gtsam::internal::getTicTocID("Total")));
-  ::gtsam::internal::gCurrentTimer = ::gtsam::internal::gTimingRoot; }
+  ::gtsam::internal::resetTimings(); }
+
+// start recording events, keeping the last capacity events of every thread
+inline void tictoc_startRecording_(size_t capacity = 100000) {
+  ::gtsam::internal::startRecording(capacity); }
+
+// stop recording events
+inline void tictoc_stopRecording_() {
+  ::gtsam::internal::stopRecording(); }
+
+// write the recorded events as Chrome Trace Event JSON
+inline void tictoc_writeChromeTrace_(std::ostream& os) {
+  ::gtsam::internal::writeChromeTrace(os); }
+
+// write the timing outline as collapsed stacks, for flame graphs
+inline void tictoc_writeCollapsedStacks_(std::ostream& os) {
+  ::gtsam::internal::writeCollapsedStacks(os); }
 
 #ifdef ENABLE_TIMING
 #define gttic(label) gttic_(label)
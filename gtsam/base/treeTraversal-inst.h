@@ -147,25 +147,43 @@ void DepthFirstForest(FOREST& forest, DATA& rootData, VISITOR_PRE& visitorPre) {
  *  @param visitorPost \c visitorPost(node, data) will be called at every node, after visiting
  *         its children, and will be passed, by reference, the \c DATA object returned by the
  *         call to \c visitorPre (the \c DATA object may be modified by visiting the children).
+ *  @param cost \c cost(node) estimates the work in the subtree rooted at a node.  When built
+ *         with TBB, the children of nodes whose cost is at least \c costThreshold are
+ *         processed in separate tasks, most expensive first, and smaller subtrees in a single
+ *         task.
  *  @param rootData The data to pass by reference to \c visitorPre when it is called on each
  *         root node. */
 template<class FOREST, typename DATA, typename VISITOR_PRE,
-    typename VISITOR_POST>
+    typename VISITOR_POST, typename COST>
 void DepthFirstForestParallel(FOREST& forest, DATA& rootData,
     VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost,
-    int problemSizeThreshold = 10) {
+    const COST& cost, double costThreshold) {
 #ifdef GTSAM_USE_TBB
   // Typedefs
   typedef typename FOREST::Node Node;
 
   tbb::task::spawn_root_and_wait(
       internal::CreateRootTask<Node>(forest.roots(), rootData, visitorPre,
-          visitorPost, problemSizeThreshold));
+          visitorPost, cost, costThreshold));
 #else
   DepthFirstForest(forest, rootData, visitorPre, visitorPost);
 #endif
 }
 
+/** Traverse a forest depth-first with pre-order and post-order visits, in parallel as above,
+ *  creating tasks for the children of nodes whose \c problemSize() is at least
+ *  \c problemSizeThreshold. */
+template<class FOREST, typename DATA, typename VISITOR_PRE,
+    typename VISITOR_POST>
+void DepthFirstForestParallel(FOREST& forest, DATA& rootData,
+    VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost,
+    int problemSizeThreshold = 10) {
+  typedef typename FOREST::Node Node;
+  DepthFirstForestParallel(forest, rootData, visitorPre, visitorPost,
+      [](const boost::shared_ptr<Node>& node) { return node->problemSize(); },
+      problemSizeThreshold);
+}
+
 /* ************************************************************************* */
 /** Traversal function for CloneForest */
 namespace {
@@ -21,6 +21,9 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #ifdef GTSAM_USE_TBB
 #include <tbb/task.h>               // tbb::task, tbb::task_list
 #include <tbb/scalable_allocator.h> // tbb::scalable_allocator
@@ -33,7 +36,20 @@ namespace gtsam {
     namespace internal {
 
       /* ************************************************************************* */
-      template<typename NODE, typename DATA, typename VISITOR_PRE, typename VISITOR_POST>
+      /// Tasks with the estimated cost of the subtrees they process
+      typedef std::vector<std::pair<double, tbb::task*> > CostedTasks;
+
+      /// Sort tasks by decreasing cost, so that the most expensive subtrees are started first
+      inline void sortByDecreasingCost(CostedTasks& tasks)
+      {
+        std::stable_sort(tasks.begin(), tasks.end(),
+            [](const CostedTasks::value_type& a, const CostedTasks::value_type& b) {
+              return a.first > b.first;
+            });
+      }
+
+      /* ************************************************************************* */
+      template<typename NODE, typename DATA, typename VISITOR_PRE, typename VISITOR_POST, typename COST>
       class PreOrderTask : public tbb::task
       {
       public:
@@ -41,19 +57,21 @@ namespace gtsam {
         boost::shared_ptr<DATA> myData;
         VISITOR_PRE& visitorPre;
         VISITOR_POST& visitorPost;
-        int problemSizeThreshold;
+        const COST& cost;
+        double costThreshold;
         bool makeNewTasks;
 
         bool isPostOrderPhase;
 
         PreOrderTask(const boost::shared_ptr<NODE>& treeNode, const boost::shared_ptr<DATA>& myData,
-                     VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost, int problemSizeThreshold,
-                     bool makeNewTasks = true)
+                     VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost, const COST& cost,
+                     double costThreshold, bool makeNewTasks = true)
             : treeNode(treeNode),
               myData(myData),
               visitorPre(visitorPre),
               visitorPost(visitorPost),
-              problemSizeThreshold(problemSizeThreshold),
+              cost(cost),
+              costThreshold(costThreshold),
               makeNewTasks(makeNewTasks),
               isPostOrderPhase(false) {}
 
@@ -75,10 +93,10 @@ namespace gtsam {
                 isPostOrderPhase = true;
                 recycle_as_continuation();
 
-                bool overThreshold = (treeNode->problemSize() >= problemSizeThreshold);
+                bool overThreshold = (cost(treeNode) >= costThreshold);
 
-                tbb::task* firstChild = 0;
-                tbb::task_list childTasks;
+                CostedTasks childTasks;
+                childTasks.reserve(treeNode->children.size());
                 for(const boost::shared_ptr<NODE>& child: treeNode->children)
                 {
                   // Process child in a subtask.  Important:  Run visitorPre before calling
@@ -88,17 +106,21 @@ namespace gtsam {
                       tbb::scalable_allocator<DATA>(), visitorPre(child, *myData));
                   tbb::task* childTask =
                       new (allocate_child()) PreOrderTask(child, childData, visitorPre, visitorPost,
-                                                          problemSizeThreshold, overThreshold);
-                  if (firstChild)
-                    childTasks.push_back(*childTask);
-                  else
-                    firstChild = childTask;
+                                                          cost, costThreshold, overThreshold);
+                  childTasks.push_back(std::make_pair(double(cost(child)), childTask));
                 }
 
+                // The first child runs in this thread and idle threads steal the others in the
+                // order they are spawned, so we start with the most expensive subtrees
+                sortByDecreasingCost(childTasks);
+                tbb::task_list otherChildTasks;
+                for(size_t i = 1; i < childTasks.size(); ++i)
+                  otherChildTasks.push_back(*childTasks[i].second);
+
                 // If we have child tasks, start subtasks and wait for them to complete
                 set_ref_count((int)treeNode->children.size());
-                spawn(childTasks);
-                return firstChild;
+                spawn(otherChildTasks);
+                return childTasks.front().second;
               }
               else
               {
@@ -130,7 +152,8 @@ namespace gtsam {
       };
 
       /* ************************************************************************* */
-      template<typename ROOTS, typename NODE, typename DATA, typename VISITOR_PRE, typename VISITOR_POST>
+      template<typename ROOTS, typename NODE, typename DATA, typename VISITOR_PRE, typename VISITOR_POST,
+               typename COST>
       class RootTask : public tbb::task
       {
       public:
@@ -138,23 +161,29 @@ namespace gtsam {
         DATA& myData;
         VISITOR_PRE& visitorPre;
         VISITOR_POST& visitorPost;
-        int problemSizeThreshold;
+        const COST& cost;
+        double costThreshold;
         RootTask(const ROOTS& roots, DATA& myData, VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost,
-          int problemSizeThreshold) :
+          const COST& cost, double costThreshold) :
           roots(roots), myData(myData), visitorPre(visitorPre), visitorPost(visitorPost),
-          problemSizeThreshold(problemSizeThreshold) {}
+          cost(cost), costThreshold(costThreshold) {}
 
         tbb::task* execute()
         {
-          typedef PreOrderTask<NODE, DATA, VISITOR_PRE, VISITOR_POST> PreOrderTask;
+          typedef PreOrderTask<NODE, DATA, VISITOR_PRE, VISITOR_POST, COST> PreOrderTask;
           // Create data and tasks for our children
-          tbb::task_list tasks;
+          CostedTasks costedTasks;
           for(const boost::shared_ptr<NODE>& root: roots)
           {
             boost::shared_ptr<DATA> rootData = boost::allocate_shared<DATA>(tbb::scalable_allocator<DATA>(), visitorPre(root, myData));
-            tasks.push_back(*new(allocate_child())
-              PreOrderTask(root, rootData, visitorPre, visitorPost, problemSizeThreshold));
+            costedTasks.push_back(std::make_pair(double(cost(root)), new(allocate_child())
+              PreOrderTask(root, rootData, visitorPre, visitorPost, cost, costThreshold)));
           }
+          // Spawn the most expensive trees first
+          sortByDecreasingCost(costedTasks);
+          tbb::task_list tasks;
+          for(const CostedTasks::value_type& costedTask: costedTasks)
+            tasks.push_back(*costedTask.second);
           // Set TBB ref count
           set_ref_count(1 + (int) roots.size());
           // Spawn tasks
@@ -164,12 +193,14 @@ namespace gtsam {
         }
       };
 
-      template<typename NODE, typename ROOTS, typename DATA, typename VISITOR_PRE, typename VISITOR_POST>
-      RootTask<ROOTS, NODE, DATA, VISITOR_PRE, VISITOR_POST>&
-        CreateRootTask(const ROOTS& roots, DATA& rootData, VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost, int problemSizeThreshold)
+      template<typename NODE, typename ROOTS, typename DATA, typename VISITOR_PRE, typename VISITOR_POST,
+               typename COST>
+      RootTask<ROOTS, NODE, DATA, VISITOR_PRE, VISITOR_POST, COST>&
+        CreateRootTask(const ROOTS& roots, DATA& rootData, VISITOR_PRE& visitorPre, VISITOR_POST& visitorPost,
+                       const COST& cost, double costThreshold)
       {
-          typedef RootTask<ROOTS, NODE, DATA, VISITOR_PRE, VISITOR_POST> RootTask;
-          return *new(tbb::task::allocate_root()) RootTask(roots, rootData, visitorPre, visitorPost, problemSizeThreshold);
+          typedef RootTask<ROOTS, NODE, DATA, VISITOR_PRE, VISITOR_POST, COST> RootTask;
+          return *new(tbb::task::allocate_root()) RootTask(roots, rootData, visitorPre, visitorPost, cost, costThreshold);
         }
 
     }
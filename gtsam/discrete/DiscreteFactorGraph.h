@@ -55,6 +55,9 @@ template<> struct EliminationTraits<DiscreteFactorGraph>
   static std::pair<boost::shared_ptr<ConditionalType>, boost::shared_ptr<FactorType> >
   DefaultEliminate(const FactorGraphType& factors, const Ordering& keys) {
     return EliminateDiscrete(factors, keys); }
+  /// The scalar dimension of a key, used to estimate the cost of elimination
+  static size_t KeyDimension(const FactorType&, FactorType::const_iterator) {
+    return 1; }
 };
 
 /* ************************************************************************* */
@@ -152,40 +152,15 @@ public:
     // a single point is observed in m cameras
     size_t m = Fs.size();
 
-    // Create a SymmetricBlockMatrix
-    size_t M1 = D * m + 1;
-    std::vector<DenseIndex> dims(m + 1); // this also includes the b term
-    std::fill(dims.begin(), dims.end() - 1, D);
+    // Create a zero SymmetricBlockMatrix, the last block is for the b term
+    std::vector<DenseIndex> dims(m + 1, D);
     dims.back() = 1;
-    SymmetricBlockMatrix augmentedHessian(dims, Matrix::Zero(M1, M1));
+    SymmetricBlockMatrix augmentedHessian(dims);
 
-    // Blockwise Schur complement
-    for (size_t i = 0; i < m; i++) { // for each camera
-
-      const MatrixZD& Fi = Fs[i];
-      const auto FiT = Fi.transpose();
-      const Eigen::Matrix<double, ZDim, N> Ei_P = //
-          E.block(ZDim * i, 0, ZDim, N) * P;
-
-      // D = (Dx2) * ZDim
-      augmentedHessian.setOffDiagonalBlock(i, m, FiT * b.segment<ZDim>(ZDim * i) // F' * b
-      - FiT * (Ei_P * (E.transpose() * b))); // D = (DxZDim) * (ZDimx3) * (N*ZDimm) * (ZDimm x 1)
-
-      // (DxD) = (DxZDim) * ( (ZDimxD) - (ZDimx3) * (3xZDim) * (ZDimxD) )
-      augmentedHessian.setDiagonalBlock(i, FiT
-          * (Fi - Ei_P * E.block(ZDim * i, 0, ZDim, N).transpose() * Fi));
-
-      // upper triangular part of the hessian
-      for (size_t j = i + 1; j < m; j++) { // for each camera
-        const MatrixZD& Fj = Fs[j];
-
-        // (DxD) = (Dx2) * ( (2x2) * (2xD) )
-        augmentedHessian.setOffDiagonalBlock(i, j, -FiT
-            * (Ei_P * E.block(ZDim * j, 0, ZDim, N).transpose() * Fj));
-      }
-    } // end of for over cameras
-
-    augmentedHessian.diagonalBlock(m)(0, 0) += b.squaredNorm();
+    std::vector<DenseIndex> slots(m);
+    for (size_t i = 0; i < m; i++)
+      slots[i] = i;
+    AddSchurComplement<N>(Fs, E, P, b, slots, m, augmentedHessian);
     return augmentedHessian;
   }
 
@@ -194,13 +169,12 @@ public:
   static void ComputePointCovariance(Eigen::Matrix<double, N, N>& P,
       const Matrix& E, double lambda, bool diagonalDamping = false) {
 
-    Matrix EtE = E.transpose() * E;
+    Eigen::Matrix<double, N, N> EtE = E.transpose() * E;
 
     if (diagonalDamping) { // diagonal of the hessian
       EtE.diagonal() += lambda * EtE.diagonal();
     } else {
-      DenseIndex n = E.cols();
-      EtE += lambda * Eigen::MatrixXd::Identity(n, n);
+      EtE.diagonal().array() += lambda;
     }
 
     P = (EtE).inverse();
@@ -255,54 +229,86 @@ public:
     for (size_t slot = 0; slot < allKeys.size(); slot++)
       KeySlotMap.insert(std::make_pair(allKeys[slot], slot));
 
-    // Schur complement trick
-    // G = F' * F - F' * E * P * E' * F
-    // g = F' * (b - E * P * E' * b)
-
     // a single point is observed in m cameras
     size_t m = Fs.size(); // cameras observing current point
     size_t M = (augmentedHessian.rows() - 1) / D; // all cameras in the group
     assert(allKeys.size()==M);
 
-    // Blockwise Schur complement
-    for (size_t i = 0; i < m; i++) { // for each camera in the current factor
+    // allKeys are the list of all camera keys in the group, e.g, (1,3,4,5,7)
+    // we should map those to a slot in the local (grouped) hessian (0,1,2,3,4)
+    std::vector<DenseIndex> slots(m);
+    for (size_t i = 0; i < m; i++)
+      slots[i] = KeySlotMap.at(keys[i]);
+    AddSchurComplement<N>(Fs, E, P, b, slots, M, augmentedHessian);
+  }
+
+protected:
+
+  /// Number of cameras up to which AddSchurComplement does not allocate
+  enum { MaxStackCameras = 16 };
+
+  /**
+   * Add the Schur complement of a point seen in m cameras to an augmented Hessian in which all
+   * camera blocks have dimension D: camera i goes in block slots[i], and the b term in block M.
+   * With Gi = Ei' * Fi, the blocks are
+   *   G_ij = Fi' * Fi * [i==j] - Gi' * P * Gj
+   *   g_i  = Fi' * bi - Gi' * P * E' * b
+   * All blocks have fixed sizes, e.g. (D, ZDim, N) = (6, 2, 3) for a pose and a point, or
+   * (9, 2, 3) for a Cal3Bundler camera, so the per-block products do not allocate, and
+   * E' * b and the Gi are computed once per point rather than for every pair of cameras.
+   */
+  template<int N> // N = 2 or 3
+  static void AddSchurComplement(const FBlocks& Fs, const Matrix& E,
+      const Eigen::Matrix<double, N, N>& P, const Vector& b,
+      const std::vector<DenseIndex>& slots, DenseIndex M,
+      /*output ->*/SymmetricBlockMatrix& augmentedHessian) {
+    size_t m = Fs.size();
+    assert(E.rows() == ZDim * DenseIndex(m) && E.cols() == N);
+
+    // Gi and P * Gi for all cameras, and P * E' * b. All products are small and fixed
+    // size, so use lazyProduct: Eigen would otherwise call its general matrix product,
+    // which is much slower for these sizes, e.g. for 9*3 times 3*9. The blocks live on
+    // the stack unless the point is seen in many cameras.
+    typedef Eigen::Matrix<double, N, D> MatrixND;
+    MatrixND stackG[MaxStackCameras], stackPG[MaxStackCameras];
+    std::vector<MatrixND, Eigen::aligned_allocator<MatrixND> > heapG, heapPG;
+    MatrixND* G = stackG;
+    MatrixND* PG = stackPG;
+    if (m > size_t(MaxStackCameras)) {
+      heapG.resize(m);
+      heapPG.resize(m);
+      G = heapG.data();
+      PG = heapPG.data();
+    }
+    Eigen::Matrix<double, N, 1> Etb = Eigen::Matrix<double, N, 1>::Zero();
+    for (size_t i = 0; i < m; i++) {
+      const auto Ei = E.template block<ZDim, N>(ZDim * i, 0);
+      G[i].noalias() = Ei.transpose().lazyProduct(Fs[i]);
+      PG[i].noalias() = P.lazyProduct(G[i]);
+      Etb.noalias() += Ei.transpose() * b.template segment<ZDim>(ZDim * i);
+    }
+    const Eigen::Matrix<double, N, 1> PEtb = P * Etb;
 
+    for (size_t i = 0; i < m; i++) { // for each camera
       const MatrixZD& Fi = Fs[i];
-      const auto FiT = Fi.transpose();
-      const Eigen::Matrix<double, 2, N> Ei_P = E.template block<ZDim, N>(
-          ZDim * i, 0) * P;
-
-      // D = (DxZDim) * (ZDim)
-      // allKeys are the list of all camera keys in the group, e.g, (1,3,4,5,7)
-      // we should map those to a slot in the local (grouped) hessian (0,1,2,3,4)
-      // Key cameraKey_i = this->keys_[i];
-      DenseIndex aug_i = KeySlotMap.at(keys[i]);
-
-      // information vector - store previous vector
-      // vectorBlock = augmentedHessian(aug_i, aug_m).knownOffDiagonal();
-      // add contribution of current factor
-      augmentedHessian.updateOffDiagonalBlock(aug_i, M,
-          FiT * b.segment<ZDim>(ZDim * i)      // F' * b
-        - FiT * (Ei_P * (E.transpose() * b))); // D = (DxZDim) * (ZDimx3) * (N*ZDimm) * (ZDimm x 1)
-
-      // (DxD) += (DxZDim) * ( (ZDimxD) - (ZDimx3) * (3xZDim) * (ZDimxD) )
-      // add contribution of current factor
-      // TODO(gareth): Eigen doesn't let us pass the expression. Call eval() for now...
-      augmentedHessian.updateDiagonalBlock(aug_i,
-         ((FiT * (Fi - Ei_P * E.template block<ZDim, N>(ZDim * i, 0).transpose() * Fi))).eval());
+      const MatrixND& Gi = G[i];
 
-      // upper triangular part of the hessian
-      for (size_t j = i + 1; j < m; j++) { // for each camera
-        const MatrixZD& Fj = Fs[j];
+      // information vector
+      const Eigen::Matrix<double, D, 1> gi =
+          Fi.transpose() * b.template segment<ZDim>(ZDim * i) - Gi.transpose() * PEtb;
+      augmentedHessian.updateOffDiagonalBlock(slots[i], M, gi);
 
-        DenseIndex aug_j = KeySlotMap.at(keys[j]);
+      // diagonal block, of which only the upper triangle is added
+      Eigen::Matrix<double, D, D> Gii;
+      Gii.noalias() = Fi.transpose().lazyProduct(Fi);
+      Gii.noalias() -= Gi.transpose().lazyProduct(PG[i]);
+      augmentedHessian.updateDiagonalBlock(slots[i], Gii);
 
-        // (DxD) = (DxZDim) * ( (ZDimxZDim) * (ZDimxD) )
-        // off diagonal block - store previous block
-        // matrixBlock = augmentedHessian(aug_i, aug_j).knownOffDiagonal();
-        // add contribution of current factor
-        augmentedHessian.updateOffDiagonalBlock(aug_i, aug_j,
-                -FiT * (Ei_P * E.template block<ZDim, N>(ZDim * j, 0).transpose() * Fj));
+      // upper triangular part of the hessian
+      for (size_t j = i + 1; j < m; j++) { // for each camera
+        Eigen::Matrix<double, D, D> Gij;
+        Gij.noalias() = -Gi.transpose().lazyProduct(PG[j]);
+        augmentedHessian.updateOffDiagonalBlock(slots[i], slots[j], Gij);
       }
     } // end of for over cameras
 
@@ -386,6 +386,53 @@ struct traits<Pose3> : public internal::LieGroup<Pose3> {};
 template <>
 struct traits<const Pose3> : public internal::LieGroup<Pose3> {};
 
+#if !defined(GTSAM_USE_QUATERNIONS) && !defined(GTSAM_POSE3_EXPMAP)
+namespace internal {
+/**
+ * Retract Pose3 in chunks of RetractLanes, for the default chart, in which the retraction of
+ * (R, t) by [w; v] is (R * Cayley(w), t + R * v) when Rot3 uses the Cayley chart.
+ */
+template <>
+struct BatchRetract<Pose3> {
+  template <class VALUE, class DELTA, class OUTPUT>
+  static void Run(size_t n, const VALUE& value, const DELTA& delta, const OUTPUT& output) {
+    if (ROT3_DEFAULT_COORDINATES_MODE != Rot3::CAYLEY) {
+      for (size_t i = 0; i < n; ++i)
+        output(i, traits<Pose3>::Retract(value(i), delta(i)));
+      return;
+    }
+    const size_t lanes = RetractLanes::SizeAtCompileTime;
+    for (size_t begin = 0; begin < n; begin += lanes) {
+      const size_t m = std::min(lanes, n - begin);
+      RetractLanes R[3][3], t[3], w[3], v[3], RC[3][3], translation[3];
+      for (size_t k = 0; k < lanes; ++k) {
+        if (k < m) {
+          const Pose3& pose = value(begin + k);
+          GatherRotation(pose.rotation().matrix(), k, R);
+          const Vector& d = delta(begin + k);
+          for (int i = 0; i < 3; ++i) {
+            t[i](k) = pose.translation()(i);
+            w[i](k) = d(i);
+            v[i](k) = d(i + 3);
+          }
+        } else {
+          GatherRotation(I_3x3, k, R);
+          for (int i = 0; i < 3; ++i) t[i](k) = w[i](k) = v[i](k) = 0.0;
+        }
+      }
+      CayleyComposeLanes(R, w, RC);
+      for (int i = 0; i < 3; ++i)
+        translation[i] = t[i] + (R[i][0] * v[0] + R[i][1] * v[1] + R[i][2] * v[2]);
+      for (size_t k = 0; k < m; ++k) {
+        const Point3 tk(translation[0](k), translation[1](k), translation[2](k));
+        output(begin + k, Pose3(Rot3(ScatterRotation(RC, k)), tk));
+      }
+    }
+  }
+};
+}  // namespace internal
+#endif
+
 // bearing and range traits, used in RangeFactor
 template <>
 struct Bearing<Pose3, Point3> : HasBearing<Pose3, Point3, Unit3> {};
@@ -26,9 +26,11 @@
 #include <gtsam/geometry/Unit3.h>
 #include <gtsam/geometry/Quaternion.h>
 #include <gtsam/geometry/SO3.h>
+#include <gtsam/base/BatchRetract.h>
 #include <gtsam/base/concepts.h>
 #include <gtsam/config.h> // Get GTSAM_USE_QUATERNIONS macro
 
+#include <algorithm>
 #include <random>
 
 // You can override the default coordinate mode using this flag
@@ -565,5 +567,82 @@ namespace gtsam {
 
   template<>
   struct traits<const Rot3> : public internal::LieGroup<Rot3> {};
+
+#ifndef GTSAM_USE_QUATERNIONS
+  namespace internal {
+    /// One coefficient of a chunk of values, in the structure-of-arrays retract kernels
+    typedef Eigen::Array<double, 16, 1> RetractLanes;
+
+    /// RC = R * Cayley(w) for a chunk of rotations R and tangent vectors w, entry by entry,
+    /// with the same formulas as Rot3::CayleyChart::Retract
+    inline void CayleyComposeLanes(const RetractLanes R[3][3], const RetractLanes w[3],
+                                   RetractLanes RC[3][3]) {
+      const RetractLanes &x = w[0], &y = w[1], &z = w[2];
+      const RetractLanes x2 = x * x, y2 = y * y, z2 = z * z;
+      const RetractLanes xy = x * y, xz = x * z, yz = y * z;
+      const RetractLanes f = 1.0 / (4.0 + x2 + y2 + z2), _2f = 2.0 * f;
+      RetractLanes C[3][3];
+      C[0][0] = (4.0 + x2 - y2 - z2) * f;
+      C[0][1] = (xy - 2.0 * z) * _2f;
+      C[0][2] = (xz + 2.0 * y) * _2f;
+      C[1][0] = (xy + 2.0 * z) * _2f;
+      C[1][1] = (4.0 - x2 + y2 - z2) * f;
+      C[1][2] = (yz - 2.0 * x) * _2f;
+      C[2][0] = (xz - 2.0 * y) * _2f;
+      C[2][1] = (yz + 2.0 * x) * _2f;
+      C[2][2] = (4.0 - x2 - y2 + z2) * f;
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+          RC[i][j] = R[i][0] * C[0][j] + R[i][1] * C[1][j] + R[i][2] * C[2][j];
+    }
+
+    /// Gather the rotation matrix of value k of a chunk into the lanes R
+    inline void GatherRotation(const Matrix3& matrix, size_t k, RetractLanes R[3][3]) {
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+          R[i][j](k) = matrix(i, j);
+    }
+
+    /// The rotation matrix of value k of a chunk in the lanes R
+    inline Matrix3 ScatterRotation(const RetractLanes R[3][3], size_t k) {
+      Matrix3 matrix;
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+          matrix(i, j) = R[i][j](k);
+      return matrix;
+    }
+
+    /// Retract Rot3 in chunks of RetractLanes with the Cayley chart, the default for matrices
+    template <>
+    struct BatchRetract<Rot3> {
+      template <class VALUE, class DELTA, class OUTPUT>
+      static void Run(size_t n, const VALUE& value, const DELTA& delta, const OUTPUT& output) {
+        if (ROT3_DEFAULT_COORDINATES_MODE != Rot3::CAYLEY) {
+          for (size_t i = 0; i < n; ++i)
+            output(i, traits<Rot3>::Retract(value(i), delta(i)));
+          return;
+        }
+        const size_t lanes = RetractLanes::SizeAtCompileTime;
+        for (size_t begin = 0; begin < n; begin += lanes) {
+          const size_t m = std::min(lanes, n - begin);
+          RetractLanes R[3][3], w[3], RC[3][3];
+          for (size_t k = 0; k < lanes; ++k) {
+            if (k < m) {
+              GatherRotation(value(begin + k).matrix(), k, R);
+              const Vector& d = delta(begin + k);
+              for (int i = 0; i < 3; ++i) w[i](k) = d(i);
+            } else {
+              GatherRotation(I_3x3, k, R);
+              for (int i = 0; i < 3; ++i) w[i](k) = 0.0;
+            }
+          }
+          CayleyComposeLanes(R, w, RC);
+          for (size_t k = 0; k < m; ++k)
+            output(begin + k, Rot3(ScatterRotation(RC, k)));
+        }
+      }
+    };
+  }  // namespace internal
+#endif
 }
 
@@ -162,6 +162,82 @@ TEST(CameraSet, Stereo) {
   EXPECT(assert_equal(actualE, E));
 }
 
+/* ************************************************************************* */
+// Schur complement of a point seen in three distinct pose cameras (D=6)
+#include <gtsam/geometry/PinholePose.h>
+#include <gtsam/geometry/Cal3_S2.h>
+TEST(CameraSet, SchurComplementPose) {
+  typedef PinholePose<Cal3_S2> Camera;
+  typedef CameraSet<Camera> Set;
+  boost::shared_ptr<Cal3_S2> K(new Cal3_S2(500, 500, 0.1, 320, 240));
+  Set set;
+  set.push_back(Camera(Pose3(), K));
+  set.push_back(Camera(Pose3(Rot3::Ypr(0.1, -0.1, 0.2), Point3(1, 0, 0)), K));
+  set.push_back(Camera(Pose3(Rot3::Ypr(-0.2, 0.1, 0.1), Point3(0, 1, -0.5)), K));
+  const Point3 p(0.2, -0.3, 4);
+
+  Set::FBlocks Fs;
+  Matrix E;
+  Vector b = -set.reprojectionError(p, Point2Vector(3, Point2(320, 240)), Fs, E);
+  const Matrix3 P = (E.transpose() * E).inverse();
+
+  // Dense Schur complement
+  Matrix F = Matrix::Zero(6, 18);
+  for (size_t i = 0; i < 3; i++)
+    F.block<2, 6>(2 * i, 6 * i) = Fs[i];
+  const Matrix Ft = F.transpose(), Et = E.transpose();
+  const Vector v = Ft * (b - E * P * Et * b);
+  Matrix schur(19, 19);
+  schur << Ft * F - Ft * E * P * Et * F, v, v.transpose(), b.squaredNorm();
+
+  SymmetricBlockMatrix actual = Set::SchurComplement<3>(Fs, E, P, b);
+  EXPECT(assert_equal(schur, actual.selfadjointView(), 1e-6));
+
+  // Update into a larger Hessian, with the cameras in slots 3, 0, and 2
+  KeyVector allKeys {10, 11, 12, 13}, keys {13, 10, 12};
+  SymmetricBlockMatrix actualUpdate(std::vector<DenseIndex>{6, 6, 6, 6, 1});
+  Set::UpdateSchurComplement<3>(Fs, E, P, b, allKeys, keys, actualUpdate);
+  Matrix expectedUpdate = Matrix::Zero(25, 25);
+  const size_t slots[] = {3, 0, 2};
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++)
+      expectedUpdate.block<6, 6>(6 * slots[i], 6 * slots[j]) = schur.block<6, 6>(6 * i, 6 * j);
+    expectedUpdate.block<6, 1>(6 * slots[i], 24) = v.segment<6>(6 * i);
+    expectedUpdate.block<1, 6>(24, 6 * slots[i]) = v.segment<6>(6 * i).transpose();
+  }
+  expectedUpdate(24, 24) = b.squaredNorm();
+  EXPECT(assert_equal(expectedUpdate, actualUpdate.selfadjointView(), 1e-6));
+}
+
+/* ************************************************************************* */
+// A point seen in more cameras than the Schur complement keeps on the stack
+TEST(CameraSet, SchurComplementManyCameras) {
+  typedef PinholePose<Cal3_S2> Camera;
+  typedef CameraSet<Camera> Set;
+  boost::shared_ptr<Cal3_S2> K(new Cal3_S2(500, 500, 0.1, 320, 240));
+  const size_t m = 20;
+  Set set;
+  for (size_t i = 0; i < m; i++)
+    set.push_back(Camera(Pose3(Rot3::Ypr(0.01 * i, -0.02, 0.03), Point3(0.1 * i, 0, 0)), K));
+  const Point3 p(0.2, -0.3, 4);
+
+  Set::FBlocks Fs;
+  Matrix E;
+  Vector b = -set.reprojectionError(p, Point2Vector(m, Point2(320, 240)), Fs, E);
+  const Matrix3 P = (E.transpose() * E).inverse();
+
+  Matrix F = Matrix::Zero(2 * m, 6 * m);
+  for (size_t i = 0; i < m; i++)
+    F.block<2, 6>(2 * i, 6 * i) = Fs[i];
+  const Matrix Ft = F.transpose(), Et = E.transpose();
+  const Vector v = Ft * (b - E * P * Et * b);
+  Matrix schur(6 * m + 1, 6 * m + 1);
+  schur << Ft * F - Ft * E * P * Et * F, v, v.transpose(), b.squaredNorm();
+
+  SymmetricBlockMatrix actual = Set::SchurComplement<3>(Fs, E, P, b);
+  EXPECT(assert_equal(schur, actual.selfadjointView(), 1e-6));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
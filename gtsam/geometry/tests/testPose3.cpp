@@ -1026,6 +1026,24 @@ TEST(Pose3, print) {
   CHECK_EQUAL(expected.str(), actual);
 }
 
+/* ************************************************************************* */
+TEST(Pose3, BatchRetract) {
+  // More poses than one chunk of the kernel, and a partial chunk
+  vector<Pose3> poses;
+  vector<Vector> deltas;
+  for (size_t i = 0; i < 37; ++i) {
+    poses.push_back(Pose3(Rot3::Ypr(0.1 * i, -0.2, 0.3 + 0.05 * i), Point3(i, -1, 2)));
+    deltas.push_back((Vector(6) << 0.01 * i, -0.2, 0.3, 1.0, -0.1 * i, 2.0).finished());
+  }
+  vector<Pose3> actual(poses.size());
+  internal::BatchRetract<Pose3>::Run(poses.size(),
+      [&poses](size_t i) -> const Pose3& { return poses[i]; },
+      [&deltas](size_t i) -> const Vector& { return deltas[i]; },
+      [&actual](size_t i, const Pose3& pose) { actual[i] = pose; });
+  for (size_t i = 0; i < poses.size(); ++i)
+    EXPECT(assert_equal(poses[i].retract(deltas[i]), actual[i], 1e-12));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -725,6 +725,24 @@ TEST(Rot3, axisAngle) {
   CHECK_AXIS_ANGLE(_axis, theta165, Rot3::AxisAngle(axis, theta195))
 }
 
+/* ************************************************************************* */
+TEST(Rot3, BatchRetract) {
+  // More rotations than one chunk of the kernel, and a partial chunk
+  vector<Rot3> rotations;
+  vector<Vector> deltas;
+  for (size_t i = 0; i < 21; ++i) {
+    rotations.push_back(Rot3::Ypr(0.1 * i, -0.2, 0.3 + 0.05 * i));
+    deltas.push_back(Vector3(0.01 * i, -0.2, 0.3));
+  }
+  vector<Rot3> actual(rotations.size());
+  internal::BatchRetract<Rot3>::Run(rotations.size(),
+      [&rotations](size_t i) -> const Rot3& { return rotations[i]; },
+      [&deltas](size_t i) -> const Vector& { return deltas[i]; },
+      [&actual](size_t i, const Rot3& R) { actual[i] = R; });
+  for (size_t i = 0; i < rotations.size(); ++i)
+    EXPECT(assert_equal(rotations[i].retract(deltas[i]), actual[i], 1e-12));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -299,6 +299,63 @@ TEST( triangulation, outliersAndFarLandmarks) {
   EXPECT(actual.outlier());
 }
 
+//******************************************************************************
+// The fixed-size refinement should agree with optimizing the triangulation graph
+TEST( triangulation, nonlinearMatchesGraph) {
+  Pose3 pose3 = pose1 * Pose3(Rot3::Ypr(0.1, 0.2, 0.1), Point3(0.1, -2, -.1));
+  typedef PinholeCamera<Cal3_S2> Camera;
+  CameraSet<Camera> cameras;
+  cameras += camera1, camera2, Camera(pose3, *sharedCal);
+
+  Point2Vector measurements;
+  measurements += z1 + Point2(3, -1), z2 + Point2(-2, 4),
+      cameras[2].project(landmark) + Point2(1, 2);
+  const Point3 initial = landmark + Point3(0.5, -0.3, 0.2);
+
+  Values values;
+  NonlinearFactorGraph graph;
+  boost::tie(graph, values) = triangulationGraph<Camera>(cameras, measurements,
+      Symbol('p', 0), initial);
+  Point3 expected = optimize(graph, values, Symbol('p', 0));
+
+  Point3 actual = triangulateNonlinear<Camera>(cameras, measurements, initial);
+  EXPECT(assert_equal(expected, actual, 1e-6));
+
+  // Same with poses and a shared calibration
+  vector<Pose3> poses;
+  poses += pose1, pose2, pose3;
+  boost::tie(graph, values) = triangulationGraph<Cal3_S2>(poses, sharedCal,
+      measurements, Symbol('p', 0), initial);
+  expected = optimize(graph, values, Symbol('p', 0));
+
+  actual = triangulateNonlinear<Cal3_S2>(poses, sharedCal, measurements, initial);
+  EXPECT(assert_equal(expected, actual, 1e-6));
+}
+
+//******************************************************************************
+TEST( triangulation, batch) {
+  typedef PinholeCamera<Cal3_S2> Camera;
+  Pose3 pose3 = pose1 * Pose3(Rot3::Ypr(0.1, 0.2, 0.1), Point3(0.1, -2, -.1));
+  const Point3 landmark2(6, -0.5, 0.8);
+
+  vector<CameraSet<Camera> > cameras(3);
+  cameras[0] += camera1, camera2;
+  cameras[1] += camera1, camera2, Camera(pose3, *sharedCal);
+  cameras[2] += camera1;
+  vector<Point2Vector> measurements(3);
+  measurements[0] += z1 + Point2(0.1, 0.5), z2 + Point2(-0.2, 0.3);
+  measurements[1] += camera1.project(landmark2), camera2.project(landmark2),
+      cameras[1][2].project(landmark2);
+  measurements[2] += z1;
+
+  TriangulationParameters params(1.0, true);
+  vector<TriangulationResult> actual = triangulateSafe(cameras, measurements, params);
+  EXPECT_LONGS_EQUAL(3, actual.size());
+  EXPECT(assert_equal(*triangulateSafe(cameras[0], measurements[0], params), *actual[0]));
+  EXPECT(assert_equal(landmark2, *actual[1], 1e-6));
+  EXPECT(actual[2].degenerate());
+}
+
 //******************************************************************************
 TEST( triangulation, twoIdenticalPoses) {
   // create first camera. Looking along X-axis, 1 meter above ground plane (x-y)
@@ -24,6 +24,14 @@
 #include <gtsam/slam/TriangulationFactor.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/inference/Symbol.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
 
 namespace gtsam {
 
@@ -154,6 +162,49 @@ std::pair<NonlinearFactorGraph, Values> triangulationGraph(
 GTSAM_EXPORT Point3 optimize(const NonlinearFactorGraph& graph,
     const Values& values, Key landmarkKey);
 
+namespace internal {
+
+/**
+ * Evaluate the error 0.5*|e|^2 of a point, where e stacks the reprojection errors in all
+ * cameras with unit noise, as in the graph built by triangulationGraph. If H and g are given,
+ * also compute the normal equations H = J'*J and g = J'*e in the point, with fixed-size blocks
+ * and no heap allocation. As in TriangulationFactor, a camera that the point is behind adds a
+ * constant error and no gradient.
+ */
+template<class CAMERA>
+double triangulationNormalEquations(const CameraSet<CAMERA>& cameras,
+    const typename CAMERA::MeasurementVector& measurements, const Point3& point,
+    Matrix3* H = nullptr, Vector3* g = nullptr) {
+  typedef typename CAMERA::Measurement Z;
+  typedef Eigen::Matrix<double, traits<Z>::dimension, 1> ZVector;
+  typedef Eigen::Matrix<double, traits<Z>::dimension, 3> ZMatrix3;
+
+  if (H) {
+    H->setZero();
+    g->setZero();
+  }
+  double error = 0.0;
+  ZMatrix3 Ei;
+  for (size_t i = 0; i < cameras.size(); i++) {
+    ZVector ei;
+    try {
+      ei = traits<Z>::Local(measurements[i],
+          cameras[i].project2(point, boost::none, H ? &Ei : nullptr));
+    } catch (CheiralityException&) {
+      error += 0.5 * ZVector::Constant(2.0 * cameras[i].calibration().fx()).squaredNorm();
+      continue;
+    }
+    error += 0.5 * ei.squaredNorm();
+    if (H) {
+      H->noalias() += Ei.transpose() * Ei;
+      g->noalias() += Ei.transpose() * ei;
+    }
+  }
+  return error;
+}
+
+} // \namespace internal
+
 /**
  * Given an initial estimate , refine a point using measurements in several cameras
  * @param poses Camera poses
@@ -167,17 +218,19 @@ Point3 triangulateNonlinear(const std::vector<Pose3>& poses,
     boost::shared_ptr<CALIBRATION> sharedCal,
     const Point2Vector& measurements, const Point3& initialEstimate) {
 
-  // Create a factor graph and initial values
-  Values values;
-  NonlinearFactorGraph graph;
-  boost::tie(graph, values) = triangulationGraph<CALIBRATION> //
-      (poses, sharedCal, measurements, Symbol('p', 0), initialEstimate);
-
-  return optimize(graph, values, Symbol('p', 0));
+  typedef PinholePose<CALIBRATION> Camera;
+  CameraSet<Camera> cameras;
+  cameras.reserve(poses.size());
+  for (const Pose3& pose : poses)
+    cameras.push_back(Camera(pose, sharedCal));
+  return triangulateNonlinear<Camera>(cameras, measurements, initialEstimate);
 }
 
 /**
- * Given an initial estimate , refine a point using measurements in several cameras
+ * Given an initial estimate , refine a point using measurements in several cameras.
+ * This solves the same problem as optimize on the graph built by triangulationGraph, with the
+ * same Levenberg-Marquardt settings, but without building a graph or an optimizer: as there is
+ * a single 3D unknown, the normal equations are accumulated in fixed-size matrices.
  * @param cameras pinhole cameras (monocular or stereo)
  * @param measurements 2D measurements
  * @param initialEstimate
@@ -188,13 +241,40 @@ Point3 triangulateNonlinear(
     const CameraSet<CAMERA>& cameras,
     const typename CAMERA::MeasurementVector& measurements, const Point3& initialEstimate) {
 
-  // Create a factor graph and initial values
-  Values values;
-  NonlinearFactorGraph graph;
-  boost::tie(graph, values) = triangulationGraph<CAMERA> //
-      (cameras, measurements, Symbol('p', 0), initialEstimate);
+  // Levenberg-Marquardt with the settings of optimize, on the 3*3 normal equations
+  static const size_t maxIterations = 100;
+  static const double lambdaFactor = 10, lambdaUpperBound = 1e5;
+  static const double absoluteErrorTol = 1.0, relativeErrorTol = 1e-5;
+
+  Point3 point = initialEstimate;
+  Matrix3 H;
+  Vector3 g;
+  double error = internal::triangulationNormalEquations(cameras, measurements, point, &H, &g);
+  double lambda = 1.0;
+  for (size_t iteration = 0; iteration < maxIterations; iteration++) {
+    // Increase lambda until a step decreases the error
+    Point3 newPoint;
+    double newError;
+    for (;;) {
+      Matrix3 damped = H;
+      damped.diagonal().array() += lambda;
+      newPoint = point - damped.llt().solve(g);
+      newError = internal::triangulationNormalEquations(cameras, measurements, newPoint);
+      if (newError < error)
+        break;
+      lambda *= lambdaFactor;
+      if (lambda >= lambdaUpperBound)
+        return point;
+    }
+    lambda /= lambdaFactor;
+    point = newPoint;
 
-  return optimize(graph, values, Symbol('p', 0));
+    const double decrease = error - newError;
+    if (decrease <= absoluteErrorTol || decrease <= relativeErrorTol * error)
+      break;
+    error = internal::triangulationNormalEquations(cameras, measurements, point, &H, &g);
+  }
+  return point;
 }
 
 /**
@@ -515,5 +595,34 @@ TriangulationResult triangulateSafe(const CameraSet<CAMERA>& cameras,
     }
 }
 
+/**
+ * triangulateSafe for many landmarks at once, e.g. all tracks of a frame. Landmark j is
+ * triangulated from cameras[j] and measured[j], in parallel if GTSAM is built with TBB.
+ */
+template<class CAMERA>
+std::vector<TriangulationResult> triangulateSafe(
+    const std::vector<CameraSet<CAMERA> >& cameras,
+    const std::vector<typename CAMERA::MeasurementVector>& measured,
+    const TriangulationParameters& params) {
+
+  assert(measured.size() == cameras.size());
+  std::vector<TriangulationResult> results(cameras.size());
+  const auto triangulate = [&](size_t j) {
+    results[j] = triangulateSafe<CAMERA>(cameras[j], measured[j], params);
+  };
+#ifdef GTSAM_USE_TBB
+  TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, cameras.size()),
+      [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t j = range.begin(); j != range.end(); ++j)
+          triangulate(j);
+      });
+#else
+  for (size_t j = 0; j < cameras.size(); ++j)
+    triangulate(j);
+#endif
+  return results;
+}
+
 } // \namespace gtsam
 
@@ -257,6 +257,11 @@ namespace gtsam {
     // get clique containing Key j
     sharedClique clique = this->clique(j);
 
+    // return the marginal if it was computed since the clique or its ancestors changed
+    typename FastMap<Key, sharedConditional>::const_iterator cached = clique->cachedMarginals_.find(j);
+    if (cached != clique->cachedMarginals_.end())
+      return cached->second;
+
     // calculate or retrieve its marginal P(C) = P(F,S)
     FactorGraphType cliqueMarginal = clique->marginal2(function);
 
@@ -264,7 +269,8 @@ namespace gtsam {
     BayesNetType marginalBN = *cliqueMarginal.marginalMultifrontalBayesNet(
       Ordering(cref_list_of<1,Key>(j)), function);
 
-    // The Bayes net should contain only one conditional for variable j, so return it
+    // The Bayes net should contain only one conditional for variable j, cache and return it
+    clique->cachedMarginals_[j] = marginalBN.front();
     return marginalBN.front();
   }
 
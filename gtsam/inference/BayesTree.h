@@ -165,7 +165,8 @@ namespace gtsam {
      *  solution may be directly obtained by calling .solve() on the returned object.
      *  Alternatively, it may be directly used as its factor base class.  For example, for Gaussian
      *  systems, this returns a GaussianConditional, which inherits from JacobianFactor and
-     *  GaussianFactor. */
+     *  GaussianFactor.  The marginal is cached in the clique of j, and reused until that clique or
+     *  one of its ancestors is removed from the tree, e.g. by ISAM2::update. */
     sharedConditional marginalFactor(Key j, const Eliminate& function = EliminationTraitsType::DefaultEliminate) const;
 
     /**
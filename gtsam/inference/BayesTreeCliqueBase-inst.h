@@ -208,7 +208,7 @@ namespace gtsam {
       }
 
       //Delete CachedShortcut for this clique
-      cachedSeparatorMarginal_ = boost::none;
+      deleteCachedShortcutsNonRecursive();
     }
 
   }
@@ -20,6 +20,7 @@
 #include <gtsam/inference/Key.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/base/types.h>
+#include <gtsam/base/FastMap.h>
 #include <gtsam/base/FastVector.h>
 #include <boost/optional.hpp>
 
@@ -80,6 +81,10 @@ namespace gtsam {
     /// This stores the Cached separator margnal P(S)
     mutable boost::optional<FactorGraphType> cachedSeparatorMarginal_;
 
+    /// Cached marginals P(j) of frontal variables, computed by BayesTree::marginalFactor. These
+    /// depend on the separator marginal and are deleted along with it.
+    mutable FastMap<Key, sharedConditional> cachedMarginals_;
+
   public:
     sharedConditional conditional_;
     derived_weak_ptr parent_;
@@ -146,6 +151,10 @@ namespace gtsam {
     const boost::optional<FactorGraphType>& cachedSeparatorMarginal() const {
       return cachedSeparatorMarginal_; }
 
+    /** The cached marginals of frontal variables, see BayesTree::marginalFactor */
+    const FastMap<Key, sharedConditional>& cachedMarginals() const {
+      return cachedMarginals_; }
+
     friend class BayesTree<DerivedType>;
 
   protected:
@@ -159,7 +168,10 @@ namespace gtsam {
     KeyVector shortcut_indices(const derived_ptr& B, const FactorGraphType& p_Cp_B) const;
 
     /** Non-recursive delete cached shortcuts and marginals - internal only. */
-    void deleteCachedShortcutsNonRecursive() { cachedSeparatorMarginal_ = boost::none; }
+    void deleteCachedShortcutsNonRecursive() {
+      cachedSeparatorMarginal_ = boost::none;
+      cachedMarginals_.clear();
+    }
 
   private:
 
@@ -218,7 +218,8 @@ EliminatableClusterTree<BAYESTREE, GRAPH>& EliminatableClusterTree<BAYESTREE, GR
 /* ************************************************************************* */
 template <class BAYESTREE, class GRAPH>
 std::pair<boost::shared_ptr<BAYESTREE>, boost::shared_ptr<GRAPH> >
-EliminatableClusterTree<BAYESTREE, GRAPH>::eliminate(const Eliminate& function) const {
+EliminatableClusterTree<BAYESTREE, GRAPH>::eliminate(const Eliminate& function,
+                                                     double parallelCostThreshold) const {
   gttic(ClusterTree_eliminate);
   // Do elimination (depth-first traversal).  The rootsContainer stores a 'dummy' BayesTree node
   // that contains all of the roots as its children.  rootsContainer also stores the remaining
@@ -231,8 +232,9 @@ EliminatableClusterTree<BAYESTREE, GRAPH>::eliminate(const Eliminate& function)
   typename Data::EliminationPostOrderVisitor visitorPost(function, result->nodes_);
   {
     TbbOpenMPMixedScope threadLimiter;  // Limits OpenMP threads since we're mixing TBB and OpenMP
-    treeTraversal::DepthFirstForestParallel(*this, rootsContainer, Data::EliminationPreOrderVisitor,
-                                            visitorPost, 10);
+    treeTraversal::DepthFirstForestParallel(
+        *this, rootsContainer, Data::EliminationPreOrderVisitor, visitorPost,
+        [](const typename This::sharedNode& node) { return node->cost(); }, parallelCostThreshold);
   }
 
   // Create BayesTree from roots stored in the dummy BayesTree node.
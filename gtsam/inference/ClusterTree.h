@@ -44,7 +44,11 @@ class ClusterTree {
 
     int problemSize_;
 
-    Cluster() : problemSize_(0) {}
+    /// Estimated flops to eliminate the subtree rooted at this cluster, set by the JunctionTree
+    /// constructor from the scalar dimensions of the frontal and separator variables of each clique
+    double cost_;
+
+    Cluster() : problemSize_(0), cost_(0) {}
 
     virtual ~Cluster() {}
 
@@ -55,7 +59,7 @@ class ClusterTree {
     /// Construct from factors associated with a single key
     template <class CONTAINER>
     Cluster(Key key, const CONTAINER& factorsToAdd)
-        : problemSize_(0) {
+        : problemSize_(0), cost_(0) {
       addFactors(key, factorsToAdd);
     }
 
@@ -89,6 +93,10 @@ class ClusterTree {
       return problemSize_;
     }
 
+    double cost() const {
+      return cost_;
+    }
+
     /// print this node
     virtual void print(const std::string& s = "",
                        const KeyFormatter& keyFormatter = DefaultKeyFormatter) const;
@@ -217,10 +225,12 @@ class EliminatableClusterTree : public ClusterTree<GRAPH> {
   /** Eliminate the factors to a Bayes tree and remaining factor graph
    * @param function The function to use to eliminate, see the namespace functions
    * in GaussianFactorGraph.h
+   * @param parallelCostThreshold When built with TBB, subtrees whose estimated cost (see
+   * Cluster::cost) is below this threshold are eliminated in a single task
    * @return The Bayes tree and factor graph resulting from elimination
    */
   std::pair<boost::shared_ptr<BayesTreeType>, boost::shared_ptr<FactorGraphType> > eliminate(
-      const Eliminate& function) const;
+      const Eliminate& function, double parallelCostThreshold = 1e5) const;
 
   /// @}
 
@@ -83,6 +83,16 @@ namespace gtsam {
     EliminateableFactorGraph<FACTORGRAPH>::eliminateMultifrontal(
     OptionalOrderingType orderingType, const Eliminate& function,
     OptionalVariableIndex variableIndex) const
+  {
+    return eliminateMultifrontal(orderingType, function, 1e5, variableIndex);
+  }
+
+  /* ************************************************************************* */
+  template<class FACTORGRAPH>
+  boost::shared_ptr<typename EliminateableFactorGraph<FACTORGRAPH>::BayesTreeType>
+    EliminateableFactorGraph<FACTORGRAPH>::eliminateMultifrontal(
+    OptionalOrderingType orderingType, const Eliminate& function,
+    double parallelCostThreshold, OptionalVariableIndex variableIndex) const
   {
     if(!variableIndex) {
       // If no VariableIndex provided, compute one and call this function again IMPORTANT: we check
@@ -90,17 +100,20 @@ namespace gtsam {
       // no Ordering is provided.  When removing optional from VariableIndex, create VariableIndex
       // before creating ordering.
       VariableIndex computedVariableIndex(asDerived());
-      return eliminateMultifrontal(function, computedVariableIndex, orderingType);
+      return eliminateMultifrontal(orderingType, function, parallelCostThreshold,
+                                   computedVariableIndex);
     }
     else {
       // Compute an ordering and call this function again.  We are guaranteed to have a
       // VariableIndex already here because we computed one if needed in the previous 'if' block.
       if (orderingType == Ordering::METIS) {
         Ordering computedOrdering = Ordering::Metis(asDerived());
-        return eliminateMultifrontal(computedOrdering, function, variableIndex, orderingType);
+        return eliminateMultifrontal(computedOrdering, function, parallelCostThreshold,
+                                     variableIndex);
       } else {
         Ordering computedOrdering = Ordering::Colamd(*variableIndex);
-        return eliminateMultifrontal(computedOrdering, function, variableIndex, orderingType);
+        return eliminateMultifrontal(computedOrdering, function, parallelCostThreshold,
+                                     variableIndex);
       }
     }
   }
@@ -111,11 +124,22 @@ namespace gtsam {
     EliminateableFactorGraph<FACTORGRAPH>::eliminateMultifrontal(
     const Ordering& ordering, const Eliminate& function,
     OptionalVariableIndex variableIndex) const
+  {
+    return eliminateMultifrontal(ordering, function, 1e5, variableIndex);
+  }
+
+  /* ************************************************************************* */
+  template<class FACTORGRAPH>
+  boost::shared_ptr<typename EliminateableFactorGraph<FACTORGRAPH>::BayesTreeType>
+    EliminateableFactorGraph<FACTORGRAPH>::eliminateMultifrontal(
+    const Ordering& ordering, const Eliminate& function,
+    double parallelCostThreshold, OptionalVariableIndex variableIndex) const
   {
     if(!variableIndex) {
       // If no VariableIndex provided, compute one and call this function again
       VariableIndex computedVariableIndex(asDerived());
-      return eliminateMultifrontal(ordering, function, computedVariableIndex);
+      return eliminateMultifrontal(ordering, function, parallelCostThreshold,
+                                   computedVariableIndex);
     } else {
       gttic(eliminateMultifrontal);
       // Do elimination with given ordering
@@ -123,7 +147,7 @@ namespace gtsam {
       JunctionTreeType junctionTree(etree);
       boost::shared_ptr<BayesTreeType> bayesTree;
       boost::shared_ptr<FactorGraphType> factorGraph;
-      boost::tie(bayesTree,factorGraph) = junctionTree.eliminate(function);
+      boost::tie(bayesTree,factorGraph) = junctionTree.eliminate(function, parallelCostThreshold);
       // If any factors are remaining, the ordering was incomplete
       if(!factorGraph->empty())
         throw InconsistentEliminationRequested();
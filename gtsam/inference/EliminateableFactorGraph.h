@@ -45,6 +45,8 @@ namespace gtsam {
     // static pair<shared_ptr<ConditionalType>, shared_ptr<FactorType>
     //   DefaultEliminate(
     //   const MyFactorGraph& factors, const Ordering& keys); ///< The default dense elimination function
+    // static size_t KeyDimension(
+    //   const MyFactor& factor, MyFactor::const_iterator key); ///< Scalar dimension of a key, used to estimate elimination cost
   };
 
 
@@ -173,6 +175,23 @@ namespace gtsam {
       const Eliminate& function = EliminationTraitsType::DefaultEliminate,
       OptionalVariableIndex variableIndex = boost::none) const;
 
+    /** Do multifrontal elimination as above, where with TBB, subtrees whose estimated cost is
+     *  below parallelCostThreshold are eliminated in a single task, see
+     *  EliminatableClusterTree::eliminate. */
+    boost::shared_ptr<BayesTreeType> eliminateMultifrontal(
+      OptionalOrderingType orderingType,
+      const Eliminate& function,
+      double parallelCostThreshold,
+      OptionalVariableIndex variableIndex = boost::none) const;
+
+    /** Do multifrontal elimination in the given ordering as above, where with TBB, subtrees
+     *  whose estimated cost is below parallelCostThreshold are eliminated in a single task. */
+    boost::shared_ptr<BayesTreeType> eliminateMultifrontal(
+      const Ordering& ordering,
+      const Eliminate& function,
+      double parallelCostThreshold,
+      OptionalVariableIndex variableIndex = boost::none) const;
+
     /** Do sequential elimination of some variables, in \c ordering provided, to produce a Bayes net
      *  and a remaining factor graph.  This computes the factorization \f$ p(X) = p(A|B) p(B) \f$,
      *  where \f$ A = \f$ \c variables, \f$ X \f$ is all the variables in the factor graph, and \f$
@@ -21,6 +21,7 @@
 #include <boost/bind.hpp>
 #include <stack>
 
+#include <gtsam/config.h> // for GTSAM_USE_TBB
 #include <gtsam/base/timing.h>
 #include <gtsam/base/treeTraversal-inst.h>
 #include <gtsam/inference/EliminationTree.h>
@@ -28,6 +29,11 @@
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/inference/inference-inst.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace gtsam {
 
   /* ************************************************************************* */
@@ -88,52 +94,62 @@ namespace gtsam {
     static const size_t none = std::numeric_limits<size_t>::max();
 
     // Allocate result parent vector and vector of last factor columns
-    FastVector<sharedNode> nodes(n);
     FastVector<size_t> parents(n, none);
     FastVector<size_t> prevCol(m, none);
     FastVector<bool> factorUsed(m, false);
 
+    // The factors and children of each node, in the order they are found, as ranges
+    // [factorsStart[j], factorsStart[j+1]) into nodeFactors and likewise for the children
+    FastVector<size_t> nodeFactors, nodeChildren;
+    FastVector<size_t> factorsStart(n + 1), childrenStart(n + 1);
+    FastVector<size_t> subtreeSizes(n, 1);
+    nodeFactors.reserve(m);
+    nodeChildren.reserve(n);
+
+    gttic(EliminationTree_parents);
+    // Shortcuts from a node towards the root of its current tree, which are compressed to the
+    // current node on the way up so finding the root takes nearly constant time
+    FastVector<size_t> ancestors(n, none);
     try {
       // for column j \in 1 to n do
       for (size_t j = 0; j < n; j++)
       {
-        // Retrieve the factors involving this variable and create the current node
+        // Retrieve the factors involving this variable
         const FactorIndices& factors = structure[order[j]];
-        const sharedNode node = boost::make_shared<Node>();
-        node->key = order[j];
+        factorsStart[j] = nodeFactors.size();
+        childrenStart[j] = nodeChildren.size();
 
         // for row i \in Struct[A*j] do
-        node->children.reserve(factors.size());
-        node->factors.reserve(factors.size());
         for(const size_t i: factors) {
           // If we already hit a variable in this factor, make the subtree containing the previous
           // variable in this factor a child of the current node.  This means that the variables
           // eliminated earlier in the factor depend on the later variables in the factor.  If we
           // haven't yet hit a variable in this factor, we add the factor to the current node.
-          // TODO: Store root shortcuts instead of parents.
           if (prevCol[i] != none) {
-            size_t k = prevCol[i];
-            // Find root r of the current tree that contains k. Use raw pointers in computing the
-            // parents to avoid changing the reference counts while traversing up the tree.
-            size_t r = k;
-            while (parents[r] != none)
-              r = parents[r];
-            // If the root of the subtree involving this node is actually the current node,
-            // TODO: what does this mean?  forest?
-            if (r != j) {
-              // Now that we found the root, hook up parent and child pointers in the nodes.
-              parents[r] = j;
-              node->children.push_back(nodes[r]);
+            // Find root r of the current tree that contains the previous variable, unless that is
+            // already the current node, and hook it up as a child of the current node.
+            size_t r = prevCol[i];
+            while (r != j) {
+              const size_t next = ancestors[r];
+              ancestors[r] = j;
+              if (next == none) {
+                parents[r] = j;
+                nodeChildren.push_back(r);
+                subtreeSizes[j] += subtreeSizes[r];
+                break;
+              }
+              r = next;
             }
           } else {
             // Add the factor to the current node since we are at the first variable in this factor.
-            node->factors.push_back(graph[i]);
+            nodeFactors.push_back(i);
             factorUsed[i] = true;
           }
           prevCol[i] = j;
         }
-        nodes[j] = node;
       }
+      factorsStart[n] = nodeFactors.size();
+      childrenStart[n] = nodeChildren.size();
     } catch(std::invalid_argument& e) {
       // If this is thrown from structure[order[j]] above, it means that it was requested to
       // eliminate a variable not present in the graph, so throw a more informative error message.
@@ -142,6 +158,40 @@ namespace gtsam {
     } catch(...) {
       throw;
     }
+    gttoc(EliminationTree_parents);
+
+    // Create the nodes, and then hook up the children, in parallel if we have TBB
+    gttic(EliminationTree_nodes);
+    FastVector<sharedNode> nodes(n);
+    auto createNodes = [&](size_t begin, size_t end) {
+      for (size_t j = begin; j < end; ++j) {
+        const sharedNode node = boost::make_shared<Node>();
+        node->key = order[j];
+        node->subtreeSize = subtreeSizes[j];
+        node->factors.reserve(factorsStart[j + 1] - factorsStart[j]);
+        for (size_t k = factorsStart[j]; k < factorsStart[j + 1]; ++k)
+          node->factors.push_back(graph[nodeFactors[k]]);
+        nodes[j] = node;
+      }
+    };
+    auto addChildren = [&](size_t begin, size_t end) {
+      for (size_t j = begin; j < end; ++j) {
+        Node& node = *nodes[j];
+        node.children.reserve(childrenStart[j + 1] - childrenStart[j]);
+        for (size_t k = childrenStart[j]; k < childrenStart[j + 1]; ++k)
+          node.children.push_back(nodes[nodeChildren[k]]);
+      }
+    };
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+        [&](const tbb::blocked_range<size_t>& range) { createNodes(range.begin(), range.end()); });
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+        [&](const tbb::blocked_range<size_t>& range) { addChildren(range.begin(), range.end()); });
+#else
+    createNodes(0, n);
+    addChildren(0, n);
+#endif
+    gttoc(EliminationTree_nodes);
 
     // Find roots
     assert(parents.empty() || parents.back() == none); // We expect the last-eliminated node to be a root no matter what
@@ -70,6 +70,7 @@ namespace gtsam {
       Key key; ///< key associated with root
       Factors factors; ///< factors associated with root
       Children children; ///< sub-trees
+      size_t subtreeSize = 1; ///< number of nodes in the subtree rooted at this node
 
       sharedFactor eliminate(const boost::shared_ptr<BayesNetType>& output,
         const Eliminate& function, const FastVector<sharedFactor>& childrenFactors) const;
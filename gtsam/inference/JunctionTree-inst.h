@@ -22,20 +22,29 @@
 
 #include <gtsam/inference/JunctionTree.h>
 #include <gtsam/inference/ClusterTree-inst.h>
+#include <gtsam/inference/EliminateableFactorGraph.h>
 #include <gtsam/symbolic/SymbolicConditional.h>
 #include <gtsam/symbolic/SymbolicFactor-inst.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace gtsam {
 
 template<class BAYESTREE, class GRAPH, class ETREE_NODE>
 struct ConstructorTraversalData {
   typedef typename JunctionTree<BAYESTREE, GRAPH>::Node Node;
   typedef typename JunctionTree<BAYESTREE, GRAPH>::sharedNode sharedNode;
+  typedef std::vector<std::pair<Key, size_t> > KeyDimensions; ///< Sorted by key
 
   ConstructorTraversalData* const parentData;
+  size_t myIndexInParent;
   sharedNode myJTNode;
   FastVector<SymbolicConditional::shared_ptr> childSymbolicConditionals;
   FastVector<SymbolicFactor::shared_ptr> childSymbolicFactors;
+  FastVector<KeyDimensions> childSeparatorDims; ///< Scalar dimensions of the separator keys
+  FastVector<size_t> childFrontalDims; ///< Total scalar dimension of the frontal keys
 
   // Small inner class to store symbolic factors
   class SymbolicFactors: public FactorGraph<Factor> {
@@ -43,6 +52,17 @@ struct ConstructorTraversalData {
 
   ConstructorTraversalData(ConstructorTraversalData* _parentData) :
       parentData(_parentData) {
+    // Reserve the slots for our symbolic elimination results in the parent, so that siblings can
+    // be processed in parallel
+    if (parentData) {
+      myIndexInParent = parentData->childSymbolicConditionals.size();
+      parentData->childSymbolicConditionals.push_back(SymbolicConditional::shared_ptr());
+      parentData->childSymbolicFactors.push_back(SymbolicFactor::shared_ptr());
+      parentData->childSeparatorDims.push_back(KeyDimensions());
+      parentData->childFrontalDims.push_back(0);
+    } else {
+      myIndexInParent = 0;
+    }
   }
 
   // Pre-order visitor function
@@ -88,8 +108,8 @@ struct ConstructorTraversalData {
         symbolicFactors, keyAsOrdering);
 
     // Store symbolic elimination results in the parent
-    myData.parentData->childSymbolicConditionals.push_back(myConditional);
-    myData.parentData->childSymbolicFactors.push_back(mySeparatorFactor);
+    myData.parentData->childSymbolicConditionals[myData.myIndexInParent] = myConditional;
+    myData.parentData->childSymbolicFactors[myData.myIndexInParent] = mySeparatorFactor;
 
     sharedNode node = myData.myJTNode;
     const FastVector<SymbolicConditional::shared_ptr>& childConditionals =
@@ -117,6 +137,51 @@ struct ConstructorTraversalData {
 
     // now really merge
     node->mergeChildren(merge);
+
+    // Scalar dimensions of the keys of our conditional, taken from our factors
+    // and from the separators of our children, which together involve all of them
+    KeyDimensions dims;
+    dims.reserve(myConditional->size());
+    for (Key key : *myConditional)
+      dims.emplace_back(key, 0);
+    std::sort(dims.begin(), dims.end());
+    const auto setDim = [&dims](Key key, size_t dim) {
+      const auto it = std::lower_bound(dims.begin(), dims.end(),
+                                       std::make_pair(key, size_t(0)));
+      if (it != dims.end() && it->first == key) it->second = dim;
+    };
+    for (const auto& factor : ETreeNode->factors)
+      if (factor)
+        for (auto key = factor->begin(); key != factor->end(); ++key)
+          setDim(*key, EliminationTraits<GRAPH>::KeyDimension(*factor, key));
+    for (const KeyDimensions& childDims : myData.childSeparatorDims)
+      for (const auto& key_dim : childDims)
+        setDim(key_dim.first, key_dim.second);
+
+    // The frontal dimension of the clique includes the merged children
+    size_t f = 0, s = 0;
+    KeyDimensions separatorDims;
+    separatorDims.reserve(myNrParents);
+    for (const auto& key_dim : dims) {
+      if (key_dim.first == ETreeNode->key) {
+        f += key_dim.second;
+      } else {
+        s += key_dim.second;
+        separatorDims.push_back(key_dim);
+      }
+    }
+    for (size_t i = 0; i < nrChildren; i++)
+      if (merge[i]) f += myData.childFrontalDims[i];
+    myData.parentData->childSeparatorDims[myData.myIndexInParent].swap(separatorDims);
+    myData.parentData->childFrontalDims[myData.myIndexInParent] = f;
+
+    // Estimate the flops of a dense partial factorization of the clique, with
+    // f frontal and s separator scalar dimensions, and add the cost of the
+    // subtrees below it
+    const double fd = static_cast<double>(f), sd = static_cast<double>(s);
+    node->cost_ = fd * fd * fd / 3.0 + fd * fd * sd + fd * sd * sd;
+    for (const sharedNode& child : node->children)
+      node->cost_ += child->cost_;
   }
 };
 
@@ -134,15 +199,20 @@ JunctionTree<BAYESTREE, GRAPH>::JunctionTree(
   // does its elimination tree parent.
 
   // Traverse the elimination tree, doing symbolic elimination and merging nodes
-  // as we go.  Gather the created junction tree roots in a dummy Node.
+  // as we go, in parallel if we have TBB.  Gather the created junction tree
+  // roots in a dummy Node.
   typedef typename EliminationTree<ETREE_BAYESNET, ETREE_GRAPH>::Node ETreeNode;
   typedef ConstructorTraversalData<BAYESTREE, GRAPH, ETreeNode> Data;
   Data rootData(0);
   rootData.myJTNode = boost::make_shared<typename Base::Node>(); // Make a dummy node to gather
                                                                  // the junction tree roots
-  treeTraversal::DepthFirstForest(eliminationTree, rootData,
+  // Subtrees with fewer elimination tree nodes are processed in a single task.
+  static const double parallelSubtreeSize = 1000.0;
+  treeTraversal::DepthFirstForestParallel(eliminationTree, rootData,
       Data::ConstructorTraversalVisitorPre,
-      Data::ConstructorTraversalVisitorPostAlg2);
+      Data::ConstructorTraversalVisitorPostAlg2,
+      [](const boost::shared_ptr<ETreeNode>& node) { return node->subtreeSize; },
+      parallelSubtreeSize);
 
   // Assign roots from the dummy node
   this->addChildrenAsRoots(rootData.myJTNode);
@@ -69,14 +69,13 @@ void MetisIndex::augment(const FactorGraph<FACTOR>& factors) {
   nKeys_ = keySet.size();
 
   xadj_.push_back(0); // Always set the first index to zero
-  for (iAdjMapIt = iAdjMap.begin(); iAdjMapIt != iAdjMap.end(); ++iAdjMapIt) {
-    std::vector<int32_t> temp;
-    // Copy from the FastSet into a temporary vector
-    std::copy(iAdjMapIt->second.begin(), iAdjMapIt->second.end(),
-        std::back_inserter(temp));
-    // Insert each index's set in order by appending them to the end of adj_
-    adj_.insert(adj_.end(), temp.begin(), temp.end());
-    //adj_.push_back(temp);
+  for (int32_t i = 0; i < keyCounter; ++i) {
+    // Keys without neighbors, e.g. only in unary factors, still need a row
+    iAdjMapIt = iAdjMap.find(i);
+    if (iAdjMapIt != iAdjMap.end()) {
+      // Insert each index's set in order by appending them to the end of adj_
+      adj_.insert(adj_.end(), iAdjMapIt->second.begin(), iAdjMapIt->second.end());
+    }
     xadj_.push_back((int32_t) adj_.size());
   }
 }
@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <limits>
+#include <map>
 
 #include <boost/format.hpp>
 
@@ -208,6 +209,33 @@ Ordering Ordering::ColamdConstrained(const VariableIndex& variableIndex,
   return Ordering::ColamdConstrained(variableIndex, cmember);
 }
 
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+namespace {
+// Nested dissection ordering of a graph in CSR format, as a permutation of its vertices, or empty
+// if METIS failed
+vector<idx_t> NestedDissection(vector<idx_t>& xadj, vector<idx_t>& adj) {
+  idx_t size = xadj.size() - 1;
+  vector<idx_t> perm(size);
+
+  // Without any edges every ordering is free of fill, and METIS needs at least one
+  if (size <= 1 || adj.empty()) {
+    for (idx_t i = 0; i < size; i++)
+      perm[i] = i;
+    return perm;
+  }
+
+  vector<idx_t> iperm(size);
+  int outputError = METIS_NodeND(&size, &xadj[0], &adj[0], nullptr, nullptr, &perm[0],
+      &iperm[0]);
+  if (outputError != METIS_OK) {
+    std::cout << "METIS failed during Nested Dissection ordering!\n";
+    return vector<idx_t>();
+  }
+  return perm;
+}
+}
+#endif
+
 /* ************************************************************************* */
 Ordering Ordering::Metis(const MetisIndex& met) {
 #ifdef GTSAM_SUPPORT_NESTED_DISSECTION
@@ -219,35 +247,68 @@ Ordering Ordering::Metis(const MetisIndex& met) {
     return Ordering();
   }
 
-  if (size == 1)
-  {
-    return Ordering(KeyVector(1, met.intToKey(0)));
-  }
-
   vector<idx_t> xadj = met.xadj();
   vector<idx_t> adj = met.adj();
-  vector<idx_t> perm, iperm;
+  const vector<idx_t> perm = NestedDissection(xadj, adj);
 
-  for (idx_t i = 0; i < size; i++) {
-    perm.push_back(0);
-    iperm.push_back(0);
+  Ordering result;
+  result.resize(perm.size());
+  for (size_t j = 0; j < perm.size(); ++j) {
+    // We have to add the minKey value back to obtain the original key in the Values
+    result[j] = met.intToKey(perm[j]);
   }
+  return result;
+#else
+  throw runtime_error("GTSAM was built without support for Metis-based "
+                      "nested dissection");
+#endif
+}
 
-  int outputError;
+/* ************************************************************************* */
+Ordering Ordering::MetisConstrained(const MetisIndex& met,
+    const FastMap<Key, int>& groups) {
+  if (groups.empty())
+    return Metis(met);
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+  gttic(Ordering_METIS_constrained);
 
-  outputError = METIS_NodeND(&size, &xadj[0], &adj[0], nullptr, nullptr, &perm[0],
-      &iperm[0]);
+  // Collect the vertices of each group, in group index order
+  const idx_t size = met.nValues();
+  map<int, vector<idx_t> > groupVertices;
+  for (idx_t i = 0; i < size; i++) {
+    FastMap<Key, int>::const_iterator group = groups.find(met.intToKey(i));
+    groupVertices[group == groups.end() ? 0 : group->second].push_back(i);
+  }
+
+  // Order each group by nested dissection of the subgraph induced by its vertices.  The edges to
+  // later groups are dropped, as those vertices act as the top-level separator of the group.
+  const vector<idx_t>& xadj = met.xadj();
+  const vector<idx_t>& adj = met.adj();
+  vector<idx_t> local(size, -1);  // Index of each vertex in the current subgraph
   Ordering result;
+  result.reserve(size);
+  for (const auto& group : groupVertices) {
+    const vector<idx_t>& vertices = group.second;
+    for (size_t v = 0; v < vertices.size(); ++v)
+      local[vertices[v]] = v;
+
+    vector<idx_t> subXadj(1, 0), subAdj;
+    subXadj.reserve(vertices.size() + 1);
+    for (const idx_t i : vertices) {
+      for (idx_t k = xadj[i]; k < xadj[i + 1]; ++k)
+        if (local[adj[k]] >= 0)
+          subAdj.push_back(local[adj[k]]);
+      subXadj.push_back(subAdj.size());
+    }
 
-  if (outputError != METIS_OK) {
-    std::cout << "METIS failed during Nested Dissection ordering!\n";
-    return result;
-  }
+    const vector<idx_t> perm = NestedDissection(subXadj, subAdj);
+    if (perm.size() != vertices.size())
+      return Ordering();
+    for (const idx_t v : perm)
+      result.push_back(met.intToKey(vertices[v]));
 
-  result.resize(size);
-  for (size_t j = 0; j < (size_t) size; ++j) {
-    // We have to add the minKey value back to obtain the original key in the Values
-    result[j] = met.intToKey(perm[j]);
+    for (const idx_t i : vertices)
+      local[i] = -1;
   }
   return result;
 #else
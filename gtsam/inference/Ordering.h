@@ -197,6 +197,23 @@ public:
       return Metis(MetisIndex(graph));
   }
 
+  /// Compute a nested dissection ordering with METIS in which, as in ColamdConstrained, each
+  /// group of variables in \c groups appears in group index order.  Variables not present in
+  /// \c groups are assigned to group 0.  METIS has no support for constraints, so the variables
+  /// of each group are ordered by nested dissection of the subgraph they induce, which treats
+  /// the later groups as a separator at the top of the tree.
+  static GTSAM_EXPORT Ordering MetisConstrained(const MetisIndex& met,
+      const FastMap<Key, int>& groups);
+
+  template<class FACTOR_GRAPH>
+  static Ordering MetisConstrained(const FACTOR_GRAPH& graph,
+      const FastMap<Key, int>& groups) {
+    if (graph.empty())
+      return Ordering();
+    else
+      return MetisConstrained(MetisIndex(graph), groups);
+  }
+
   /// @}
 
   /// @name Named Constructors @{
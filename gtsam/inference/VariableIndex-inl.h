@@ -20,14 +20,38 @@
 #include <gtsam/inference/VariableIndex.h>
 #include <gtsam/base/timing.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_scheduler_init.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+#endif
+
 namespace gtsam {
 
+#ifdef GTSAM_USE_TBB
+namespace internal {
+/// Graphs with at least this many factors are indexed in parallel
+static const size_t parallelVariableIndexThreshold = 10000;
+}
+#endif
+
 /* ************************************************************************* */
 template<class FG>
 void VariableIndex::augment(const FG& factors,
     boost::optional<const FactorIndices&> newFactorIndices) {
   gttic(VariableIndex_augment);
 
+#ifdef GTSAM_USE_TBB
+  // Index a large new graph in parallel
+  if (index_.empty() && !newFactorIndices &&
+      factors.size() >= internal::parallelVariableIndexThreshold) {
+    augmentParallel(factors);
+    return;
+  }
+#endif
+
   // Augment index for each factor
   for (size_t i = 0; i < factors.size(); ++i) {
     if (factors[i]) {
@@ -49,6 +73,61 @@ void VariableIndex::augment(const FG& factors,
   }
 }
 
+#ifdef GTSAM_USE_TBB
+/* ************************************************************************* */
+template<class FG>
+void VariableIndex::augmentParallel(const FG& factors) {
+  gttic(VariableIndex_augmentParallel);
+
+  // Split the factors into one contiguous range per thread. Each thread indexes its range in a
+  // std::map, whose std::allocator does not share a pool (and its lock) with the other threads.
+  typedef std::map<Key, FactorIndices> ShardMap;
+  const size_t nrShards = std::min<size_t>(
+      factors.size(), std::max(1, tbb::task_scheduler_init::default_num_threads()));
+  std::vector<ShardMap> shards(nrShards);
+  std::vector<size_t> shardEntries(nrShards, 0);
+  tbb::parallel_for(size_t(0), nrShards, [&](size_t s) {
+    const size_t begin = s * factors.size() / nrShards, end = (s + 1) * factors.size() / nrShards;
+    ShardMap& shard = shards[s];
+    for (size_t i = begin; i < end; ++i) {
+      if (!factors[i]) continue;
+      for (const Key key : *factors[i])
+        shard[key].push_back(nFactors_ + i);
+      shardEntries[s] += factors[i]->size();
+    }
+  });
+
+  // Merge the shards in key order, appending them at the end of the index. The shards hold
+  // increasing factor ranges, so concatenating the lists of a key in shard order keeps it sorted.
+  std::vector<ShardMap::iterator> next(nrShards);
+  for (size_t s = 0; s < nrShards; ++s)
+    next[s] = shards[s].begin();
+  while (true) {
+    bool found = false;
+    Key key = 0;
+    for (size_t s = 0; s < nrShards; ++s)
+      if (next[s] != shards[s].end() && (!found || next[s]->first < key)) {
+        key = next[s]->first;
+        found = true;
+      }
+    if (!found) break;
+    FactorIndices& indices = index_.emplace_hint(index_.end(), key, FactorIndices())->second;
+    for (size_t s = 0; s < nrShards; ++s)
+      if (next[s] != shards[s].end() && next[s]->first == key) {
+        if (indices.empty())
+          indices.swap(next[s]->second);
+        else
+          indices.insert(indices.end(), next[s]->second.begin(), next[s]->second.end());
+        ++next[s];
+      }
+  }
+
+  for (size_t s = 0; s < nrShards; ++s)
+    nEntries_ += shardEntries[s];
+  nFactors_ += factors.size();
+}
+#endif
+
 /* ************************************************************************* */
 template<typename ITERATOR, class FG>
 void VariableIndex::remove(ITERATOR firstFactor, ITERATOR lastFactor,
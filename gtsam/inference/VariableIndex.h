@@ -22,6 +22,7 @@
 #include <gtsam/base/FastMap.h>
 #include <gtsam/base/FastVector.h>
 #include <gtsam/dllexport.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
 
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/shared_ptr.hpp>
@@ -182,6 +183,13 @@ protected:
     return item->second; 
   }
 
+#ifdef GTSAM_USE_TBB
+  /// Add the factors of a graph to an empty index in parallel, each thread indexing one range of
+  /// the factors
+  template<class FG>
+  void augmentParallel(const FG& factors);
+#endif
+
   /// @}
 };
 
@@ -316,6 +316,63 @@ TEST(Ordering, MetisSingleNode) {
 }
 #endif
 /* ************************************************************************* */
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+TEST(Ordering, MetisIsolatedNode) {
+  // key 2 is only in a unary factor, but still needs a row in xadj
+  SymbolicFactorGraph symbolicGraph;
+  symbolicGraph.push_factor(0, 1);
+  symbolicGraph.push_factor(2);
+  symbolicGraph.push_factor(1, 3);
+
+  MetisIndex mi(symbolicGraph);
+
+  vector<int> xadjExpected, adjExpected;
+  xadjExpected += 0, 1, 3, 3, 4;
+  adjExpected += 1, 0, 3, 1;
+  EXPECT(xadjExpected == mi.xadj());
+  EXPECT(adjExpected == mi.adj());
+
+  Ordering actual = Ordering::Metis(symbolicGraph);
+  EXPECT_LONGS_EQUAL(4, actual.size());
+  EXPECT(symbolicGraph.keys() == KeySet(actual.begin(), actual.end()));
+
+  // Without any edges
+  SymbolicFactorGraph unaryGraph;
+  unaryGraph.push_factor(4);
+  unaryGraph.push_factor(6);
+  EXPECT(assert_equal(Ordering(list_of(4)(6)), Ordering::Metis(unaryGraph)));
+}
+#endif
+/* ************************************************************************* */
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+TEST(Ordering, MetisConstrained) {
+  SymbolicFactorGraph symbolicGraph = example::symbolicChain();
+  symbolicGraph.push_factor(0, 5);
+
+  // Without groups this is the METIS ordering
+  const Ordering metis = Ordering::Metis(symbolicGraph);
+  EXPECT(assert_equal(metis,
+      Ordering::MetisConstrained(symbolicGraph, FastMap<Key, int>())));
+
+  // Keys in group 1 are ordered last.  Without them the rest of the loop falls apart into the
+  // chain 5-0-1 and the isolated key 3.
+  FastMap<Key, int> groups;
+  groups[2] = 1;
+  groups[4] = 1;
+  const Ordering actual = Ordering::MetisConstrained(symbolicGraph, groups);
+  KeySet expectedFirst;
+  expectedFirst += 0, 1, 3, 5;
+  EXPECT_LONGS_EQUAL(6, actual.size());
+  EXPECT(expectedFirst == KeySet(actual.begin(), actual.begin() + 4));
+  EXPECT_LONGS_EQUAL(2, actual[4]);
+  EXPECT_LONGS_EQUAL(4, actual[5]);
+
+  // Groups of keys not in the graph are ignored
+  groups[7] = 2;
+  EXPECT(assert_equal(actual, Ordering::MetisConstrained(symbolicGraph, groups)));
+}
+#endif
+/* ************************************************************************* */
 TEST(Ordering, Create) {
 
   // create chain graph
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file BlockSparseOperator.cpp
+ * @brief The normal equations of a Gaussian factor graph as flat dense blocks, for iterative solvers
+ * @date Oct 2026
+ */
+
+#include <gtsam/linear/BlockSparseOperator.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/IterativeSolver.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#  include <tbb/parallel_for.h>
+#endif
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+BlockSparseOperator::BlockSparseOperator(const GaussianFactorGraph& gfg,
+                                         const KeyInfo& keyInfo) :
+    columns_(keyInfo.size()), rows_(0), rhs_(Vector::Zero(keyInfo.numCols())) {
+  gttic(BlockSparseOperator_build);
+  for (const KeyInfo::value_type& key_info : keyInfo) {
+    Column& column = columns_[key_info.second.index];
+    column.start = key_info.second.start;
+    column.dim = key_info.second.dim;
+  }
+
+  for (const GaussianFactor::shared_ptr& factor : gfg) {
+    if (!factor)
+      continue;
+
+    // Locate the variables of the factor in the flat vectors
+    vector<Segment> segments;
+    vector<size_t> variables;
+    DenseIndex column = 0;
+    for (GaussianFactor::const_iterator key = factor->begin(); key != factor->end(); ++key) {
+      const KeyInfoEntry& entry = keyInfo.at(*key);
+      const DenseIndex dim = factor->getDim(key);
+      segments.push_back(Segment{column, DenseIndex(entry.start), dim});
+      variables.push_back(entry.index);
+      column += dim;
+    }
+
+    if (const JacobianFactor::shared_ptr jacobian =
+            boost::dynamic_pointer_cast<JacobianFactor>(factor)) {
+      const JacobianFactor whitened = jacobian->whiten();
+      if (whitened.rows() == 0)
+        continue;
+      RowBlock block;
+      block.A = whitened.getA();
+      block.rowStart = rows_;
+      const Vector Atb = block.A.transpose() * whitened.getb();
+      for (size_t j = 0; j < segments.size(); ++j) {
+        rhs_.segment(segments[j].start, segments[j].dim) +=
+            Atb.segment(segments[j].column, segments[j].dim);
+        columns_[variables[j]].rowBlocks.push_back(BlockEntry(rowBlocks_.size(), j));
+      }
+      block.segments.swap(segments);
+      rows_ += block.A.rows();
+      rowBlocks_.push_back(block);
+    } else {
+      // Any other factor contributes 0.5 x'Gx - x'g + 0.5 f
+      const Matrix augmented = factor->augmentedInformation();
+      InformationBlock block;
+      block.G = augmented.topLeftCorner(column, column);
+      for (size_t j = 0; j < segments.size(); ++j) {
+        rhs_.segment(segments[j].start, segments[j].dim) +=
+            augmented.block(segments[j].column, column, segments[j].dim, 1);
+        columns_[variables[j]].informationBlocks.push_back(
+            BlockEntry(informationBlocks_.size(), j));
+      }
+      block.segments.swap(segments);
+      informationBlocks_.push_back(block);
+    }
+  }
+}
+
+/* ************************************************************************* */
+void BlockSparseOperator::multiplyRows(size_t begin, size_t end, const Vector& x,
+                                       Vector& e) const {
+  for (size_t i = begin; i < end; ++i) {
+    const RowBlock& block = rowBlocks_[i];
+    Eigen::VectorBlock<Vector> ei = e.segment(block.rowStart, block.A.rows());
+    ei.setZero();
+    for (const Segment& segment : block.segments)
+      ei.noalias() += block.A.middleCols(segment.column, segment.dim) *
+                      x.segment(segment.start, segment.dim);
+  }
+}
+
+/* ************************************************************************* */
+void BlockSparseOperator::multiplyColumns(size_t begin, size_t end, const Vector& x,
+                                          const Vector& e, Vector& y) const {
+  for (size_t k = begin; k < end; ++k) {
+    const Column& column = columns_[k];
+    Eigen::VectorBlock<Vector> yk = y.segment(column.start, column.dim);
+    yk.setZero();
+    for (const BlockEntry& entry : column.rowBlocks) {
+      const RowBlock& block = rowBlocks_[entry.first];
+      const Segment& segment = block.segments[entry.second];
+      yk.noalias() += block.A.middleCols(segment.column, segment.dim).transpose() *
+                      e.segment(block.rowStart, block.A.rows());
+    }
+    for (const BlockEntry& entry : column.informationBlocks) {
+      const InformationBlock& block = informationBlocks_[entry.first];
+      const Segment& row = block.segments[entry.second];
+      for (const Segment& segment : block.segments)
+        yk.noalias() += block.G.block(row.column, segment.column, row.dim, segment.dim) *
+                        x.segment(segment.start, segment.dim);
+    }
+  }
+}
+
+/* ************************************************************************* */
+void BlockSparseOperator::multiply(const Vector& x, Vector& y) const {
+  Vector e(rows_);
+  y.resize(cols());
+#ifdef GTSAM_USE_TBB
+  TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, rowBlocks_.size()),
+      [&](const tbb::blocked_range<size_t>& range) {
+        multiplyRows(range.begin(), range.end(), x, e);
+      });
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, columns_.size()),
+      [&](const tbb::blocked_range<size_t>& range) {
+        multiplyColumns(range.begin(), range.end(), x, e, y);
+      });
+#else
+  multiplyRows(0, rowBlocks_.size(), x, e);
+  multiplyColumns(0, columns_.size(), x, e, y);
+#endif
+}
+
+}
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file BlockSparseOperator.h
+ * @brief The normal equations of a Gaussian factor graph as flat dense blocks, for iterative solvers
+ * @date Oct 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/Vector.h>
+#include <gtsam/base/Matrix.h>
+#include <gtsam/dllexport.h>
+
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+
+// Forward declarations
+class GaussianFactorGraph;
+class KeyInfo;
+
+/**
+ * The Hessian \f$ A^T A \f$ of a Gaussian factor graph, with A the whitened Jacobian, as an
+ * operator on the flat vectors used by the iterative solvers, laid out as described by a KeyInfo.
+ *
+ * The factors are converted once, when the operator is built: Jacobian factors are whitened and
+ * stored as dense row blocks, and all other factors as their dense information matrix. Each
+ * block keeps the offset of its variables in the flat vectors, so a product is a sweep over
+ * the blocks, without the VectorValues conversions and map lookups of
+ * GaussianFactorGraph::multiplyHessianAdd. A product first computes \f$ e = A x \f$ over the
+ * rows of the Jacobian factors, and then \f$ A^T e \f$ plus the Hessian terms for each variable,
+ * both in parallel if TBB is enabled.
+ */
+class GTSAM_EXPORT BlockSparseOperator {
+public:
+
+  /// Build the operator for a factor graph, with variables ordered as in keyInfo
+  BlockSparseOperator(const GaussianFactorGraph& gfg, const KeyInfo& keyInfo);
+
+  /// Compute y = A'A x, resizing y if needed
+  void multiply(const Vector& x, Vector& y) const;
+
+  /// The right-hand side A'b of the normal equations, i.e. minus the gradient at zero
+  const Vector& rhs() const { return rhs_; }
+
+  /// The number of scalar variables, the size of the vectors the operator works on
+  size_t cols() const { return rhs_.size(); }
+
+private:
+
+  // The columns of a block that belong to one variable: column in the block, start in the
+  // flat vector, and dimension
+  struct Segment {
+    DenseIndex column, start, dim;
+  };
+
+  // Whitened A of a Jacobian factor, with its rows at rowStart in the flat residual
+  struct RowBlock {
+    Matrix A;
+    DenseIndex rowStart;
+    std::vector<Segment> segments;
+  };
+
+  // Information matrix of any other factor
+  struct InformationBlock {
+    Matrix G;
+    std::vector<Segment> segments;
+  };
+
+  // The contribution of a block to a variable: index of the block and of its segment
+  typedef std::pair<size_t, size_t> BlockEntry;
+
+  // Start and dimension of each variable in the flat vectors, and the blocks involving it
+  struct Column {
+    DenseIndex start, dim;
+    std::vector<BlockEntry> rowBlocks, informationBlocks;
+  };
+
+  std::vector<RowBlock> rowBlocks_;
+  std::vector<InformationBlock> informationBlocks_;
+  std::vector<Column> columns_;
+  DenseIndex rows_;  ///< Total number of rows of the Jacobian factors
+  Vector rhs_;
+
+  // e = A x for the row blocks [begin, end)
+  void multiplyRows(size_t begin, size_t end, const Vector& x, Vector& e) const;
+
+  // y = A' e + G x for the variables [begin, end)
+  void multiplyColumns(size_t begin, size_t end, const Vector& x, const Vector& e,
+                       Vector& y) const;
+};
+
+}
@@ -86,11 +86,33 @@ public:
   static BLASKernel blasTranslator(const std::string &s) ;
 };
 
+namespace internal {
+/// z = M^{-1} r, with the precondition method of the system if it has one
+template <class S, class V>
+auto precondition(const S &system, const V &r, V &z, int)
+    -> decltype(system.precondition(r, z), void()) {
+  system.precondition(r, z);
+}
+
+/// z = L^{-T} L^{-1} r, for systems that only have leftPrecondition and rightPrecondition
+template <class S, class V>
+void precondition(const S &system, const V &r, V &z, long) {
+  V y = r;
+  system.leftPrecondition(r, y);
+  system.rightPrecondition(y, z);
+}
+}
+
 /*
  * A template for the linear preconditioned conjugate gradient method.
  * System class should support residual(v, g), multiply(v,Av), scal(alpha,v), dot(v,v), axpy(alpha,x,y)
- * leftPrecondition(v, L^{-1}v, rightPrecondition(v, L^{-T}v) where preconditioner M = L*L^T
- * Note that the residual is in the preconditioned domain. Refer to Section 9.2 of Saad's book.
+ * precondition(v, M^{-1}v) where preconditioner M = L*L^T. Systems written for the split form
+ * can instead provide leftPrecondition(v, L^{-1}v) and rightPrecondition(v, L^{-T}v), which are
+ * then applied one after the other.
+ * The residual is kept in the original domain, and the preconditioner is applied as a whole,
+ * z = M^{-1} r, so it only needs to approximate M^{-1}, as e.g. a multigrid cycle does. The
+ * convergence test is on r^T M^{-1} r = |L^{-1} r|^2, the squared norm of the residual in the
+ * preconditioned domain. Refer to Section 9.2 of Saad's book.
  *
  ** REFERENCES:
  * [1] Y. Saad, "Preconditioned Iterations," in Iterative Methods for Sparse Linear Systems,
@@ -103,11 +125,10 @@ V preconditionedConjugateGradient(const S &system, const V &initial,
   V estimate, residual, direction, q1, q2;
   estimate = residual = direction = q1 = q2 = initial;
 
-  system.residual(estimate, q1);                /* q1 = b-Ax */
-  system.leftPrecondition(q1, residual);        /* r = L^{-1} (b-Ax) */
-  system.rightPrecondition(residual, direction);/* p = L^{-T} r */
+  system.residual(estimate, residual);          /* r = b-Ax */
+  internal::precondition(system, residual, direction, 0); /* p = z = M^{-1} r */
 
-  double currentGamma = system.dot(residual, residual), prevGamma, alpha, beta;
+  double currentGamma = system.dot(residual, direction), prevGamma, alpha, beta;
 
   const size_t iMaxIterations = parameters.maxIterations(),
                iMinIterations = parameters.minIterations(),
@@ -126,22 +147,20 @@ V preconditionedConjugateGradient(const S &system, const V &initial,
   for ( k = 1 ; k <= iMaxIterations && (currentGamma > threshold || k <= iMinIterations) ; k++ ) {
 
     if ( k % iReset == 0 ) {
-      system.residual(estimate, q1);                      /* q1 = b-Ax */
-      system.leftPrecondition(q1, residual);              /* r = L^{-1} (b-Ax) */
-      system.rightPrecondition(residual, direction);      /* p = L^{-T} r */
-      currentGamma = system.dot(residual, residual);
+      system.residual(estimate, residual);                /* r = b-Ax */
+      internal::precondition(system, residual, direction, 0); /* p = z = M^{-1} r */
+      currentGamma = system.dot(residual, direction);
     }
     system.multiply(direction, q1);                       /* q1 = A p */
     alpha = currentGamma / system.dot(direction, q1);     /* alpha = gamma / (p' A p) */
     system.axpy(alpha, direction, estimate);              /* estimate += alpha * p */
-    system.leftPrecondition(q1, q2);                      /* q2 = L^{-1} * q1 */
-    system.axpy(-alpha, q2, residual);                    /* r -= alpha * q2 */
+    system.axpy(-alpha, q1, residual);                    /* r -= alpha * q1 */
+    internal::precondition(system, residual, q2, 0);     /* q2 = z = M^{-1} r */
     prevGamma = currentGamma;
-    currentGamma = system.dot(residual, residual);        /* gamma = |r|^2 */
+    currentGamma = system.dot(residual, q2);              /* gamma = r' z */
     beta = currentGamma / prevGamma;
-    system.rightPrecondition(residual, q1);               /* q1 = L^{-T} r */
     system.scal(beta, direction);
-    system.axpy(1.0, q1, direction);                      /* p = q1 + beta * p */
+    system.axpy(1.0, q2, direction);                      /* p = z + beta * p */
 
     if (parameters.verbosity() >= ConjugateGradientParameters::ERROR )
        std::cout << "[PCG] k = " << k
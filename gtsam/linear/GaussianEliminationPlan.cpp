@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file GaussianEliminationPlan.cpp
+ * @brief A junction tree skeleton that is computed once and re-filled for every numerical
+ * elimination of factor graphs sharing the same sparsity structure.
+ * @date Oct 2026
+ */
+
+#include <gtsam/linear/GaussianEliminationPlan.h>
+#include <gtsam/linear/GaussianEliminationTree.h>
+#include <gtsam/linear/GaussianJunctionTree.h>
+#include <gtsam/inference/VariableIndex.h>
+#include <gtsam/inference/inferenceExceptions.h>
+#include <gtsam/base/timing.h>
+
+#include <stdexcept>
+
+namespace gtsam {
+
+  /* ************************************************************************* */
+  GaussianEliminationPlan::GaussianEliminationPlan(const GaussianFactorGraph& structure,
+                                                   const Ordering& ordering) {
+    gttic(GaussianEliminationPlan_Constructor);
+
+    // Do the symbolic work exactly as GaussianFactorGraph::eliminateMultifrontal does
+    const VariableIndex variableIndex(structure);
+    const GaussianEliminationTree etree(structure, variableIndex, ordering);
+    const GaussianJunctionTree junctionTree(etree);
+    if (!junctionTree.remainingFactors().empty())
+      throw InconsistentEliminationRequested();
+
+    // Take over the clusters, but drop the factors: they are re-distributed on every elimination
+    roots_ = junctionTree.roots();
+    FastMap<Key, Cluster*> keyClusters;
+    FastVector<sharedCluster> stack(roots_.begin(), roots_.end());
+    while (!stack.empty()) {
+      const sharedCluster cluster = stack.back();
+      stack.pop_back();
+      cluster->factors.resize(0);
+      for (Key key : cluster->orderedFrontalKeys)
+        keyClusters.insert(std::make_pair(key, cluster.get()));
+      stack.insert(stack.end(), cluster->children.begin(), cluster->children.end());
+      clusters_.push_back(cluster);
+    }
+
+    // Each factor is eliminated in the cluster of its first eliminated key
+    const FastMap<Key, size_t> positions = ordering.invert();
+    factorClusters_.resize(structure.size(), 0);
+    for (size_t i = 0; i < structure.size(); ++i) {
+      if (!structure[i] || structure[i]->empty())
+        continue;
+      Key first = structure[i]->front();
+      size_t firstPosition = positions.at(first);
+      for (Key key : *structure[i]) {
+        const size_t position = positions.at(key);
+        if (position < firstPosition) {
+          first = key;
+          firstPosition = position;
+        }
+      }
+      factorClusters_[i] = keyClusters.at(first);
+    }
+  }
+
+  /* ************************************************************************* */
+  bool GaussianEliminationPlan::matches(const GaussianFactorGraph& factors) const {
+    if (factors.size() != factorClusters_.size())
+      return false;
+    for (size_t i = 0; i < factors.size(); ++i) {
+      if (factors[i] && !factors[i]->empty() && !factorClusters_[i])
+        return false;
+    }
+    return true;
+  }
+
+  /* ************************************************************************* */
+  boost::shared_ptr<GaussianBayesTree> GaussianEliminationPlan::eliminate(
+      const GaussianFactorGraph& factors, const Eliminate& function,
+      double parallelCostThreshold) {
+    gttic(GaussianEliminationPlan_eliminate);
+    if (factors.size() != factorClusters_.size())
+      throw std::invalid_argument(
+          "GaussianEliminationPlan::eliminate: factor graph does not match the plan");
+
+    // Distribute the factors over the cached clusters
+    for (size_t i = 0; i < factors.size(); ++i) {
+      const sharedFactor& factor = factors[i];
+      if (!factor || factor->empty())
+        continue;
+      if (!factorClusters_[i])
+        throw std::invalid_argument(
+            "GaussianEliminationPlan::eliminate: factor graph does not match the plan");
+      factorClusters_[i]->factors.push_back(factor);
+    }
+
+    boost::shared_ptr<GaussianBayesTree> bayesTree;
+    boost::shared_ptr<GaussianFactorGraph> remaining;
+    try {
+      boost::tie(bayesTree, remaining) = Base::eliminate(function, parallelCostThreshold);
+    } catch (...) {
+      for (const sharedCluster& cluster : clusters_)
+        cluster->factors.resize(0);
+      throw;
+    }
+
+    // Release the factors so the plan does not keep the linear system alive
+    for (const sharedCluster& cluster : clusters_)
+      cluster->factors.resize(0);
+
+    // If any factors are remaining, the ordering was incomplete
+    if (!remaining->empty())
+      throw InconsistentEliminationRequested();
+    return bayesTree;
+  }
+
+  /* ************************************************************************* */
+  VectorValues GaussianEliminationPlan::optimize(const GaussianFactorGraph& factors,
+                                                 const Eliminate& function,
+                                                 double parallelCostThreshold) {
+    gttic(GaussianEliminationPlan_optimize);
+    return eliminate(factors, function, parallelCostThreshold)->optimize();
+  }
+
+}
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file GaussianEliminationPlan.h
+ * @brief A junction tree skeleton that is computed once and re-filled for every numerical
+ * elimination of factor graphs sharing the same sparsity structure.
+ * @date Oct 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/GaussianBayesTree.h>
+#include <gtsam/inference/ClusterTree.h>
+
+namespace gtsam {
+
+  /**
+   * Iterative solvers such as Levenberg-Marquardt repeatedly eliminate linear systems that differ
+   * in their numerical values only. Calling GaussianFactorGraph::optimize each time recomputes
+   * the VariableIndex, the elimination tree and the junction tree. This class does that symbolic
+   * work once, and records for every factor index the cluster it will be eliminated in, so that
+   * subsequent eliminations only have to distribute the new factors over the cached clusters.
+   *
+   * The plan assumes the i^th factor of every eliminated graph involves the same keys as the
+   * i^th factor of the graph it was built from; use matches() for a cheap sanity check.
+   *
+   * Note that elimination temporarily stores the factors in the cached clusters, hence a plan
+   * should not be shared between threads.
+   *
+   * \addtogroup Multifrontal
+   * \nosubgrouping
+   */
+  class GTSAM_EXPORT GaussianEliminationPlan :
+    public EliminatableClusterTree<GaussianBayesTree, GaussianFactorGraph> {
+  public:
+    typedef EliminatableClusterTree<GaussianBayesTree, GaussianFactorGraph> Base; ///< Base class
+    typedef GaussianEliminationPlan This; ///< This class
+    typedef boost::shared_ptr<This> shared_ptr; ///< Shared pointer to this class
+
+    /**
+     * Build the plan from the structure of a factor graph and an elimination ordering.
+     * @param structure A factor graph with the sparsity structure of the graphs to be eliminated
+     * @param ordering The elimination ordering, has to contain all keys in the structure
+     */
+    GaussianEliminationPlan(const GaussianFactorGraph& structure, const Ordering& ordering);
+
+    /// Number of factors in the graph the plan was built from
+    size_t nrFactors() const { return factorClusters_.size(); }
+
+    /// Number of clusters in the cached junction tree
+    size_t nrClusters() const { return clusters_.size(); }
+
+    /// Check that a factor graph has the same size and the same null factors as the structure
+    bool matches(const GaussianFactorGraph& factors) const;
+
+    /**
+     * Eliminate a factor graph with the cached structure into a Bayes tree.
+     * @param factors The factors to eliminate, the i^th factor has to involve the same keys as
+     * the i^th factor of the structure. Null factors are skipped.
+     * @param function The dense elimination function, called once per cluster
+     * @param parallelCostThreshold See EliminatableClusterTree::eliminate
+     */
+    boost::shared_ptr<GaussianBayesTree> eliminate(const GaussianFactorGraph& factors,
+                                                   const Eliminate& function,
+                                                   double parallelCostThreshold = 1e5);
+
+    /// Eliminate a factor graph with the cached structure and back-substitute
+    VectorValues optimize(const GaussianFactorGraph& factors, const Eliminate& function,
+                          double parallelCostThreshold = 1e5);
+
+  private:
+    FastVector<sharedCluster> clusters_;      ///< All clusters, used to clear the factors
+    FastVector<Cluster*> factorClusters_;     ///< Cluster for each factor index, null if none
+  };
+
+}
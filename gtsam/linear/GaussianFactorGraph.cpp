@@ -281,15 +281,19 @@ namespace gtsam {
   }
 
   /* ************************************************************************* */
-  VectorValues GaussianFactorGraph::optimize(const Eliminate& function) const {
+  VectorValues GaussianFactorGraph::optimize(const Eliminate& function,
+                                             double parallelCostThreshold) const {
     gttic(GaussianFactorGraph_optimize);
-    return BaseEliminateable::eliminateMultifrontal(function)->optimize();
+    return BaseEliminateable::eliminateMultifrontal(Ordering::COLAMD, function,
+                                                    parallelCostThreshold)->optimize();
   }
 
   /* ************************************************************************* */
-  VectorValues GaussianFactorGraph::optimize(const Ordering& ordering, const Eliminate& function) const {
+  VectorValues GaussianFactorGraph::optimize(const Ordering& ordering, const Eliminate& function,
+                                             double parallelCostThreshold) const {
     gttic(GaussianFactorGraph_optimize);
-    return BaseEliminateable::eliminateMultifrontal(ordering, function)->optimize();
+    return BaseEliminateable::eliminateMultifrontal(ordering, function,
+                                                    parallelCostThreshold)->optimize();
   }
 
   /* ************************************************************************* */
@@ -53,6 +53,9 @@ namespace gtsam {
     static std::pair<boost::shared_ptr<ConditionalType>, boost::shared_ptr<FactorType> >
       DefaultEliminate(const FactorGraphType& factors, const Ordering& keys) {
         return EliminatePreferCholesky(factors, keys); }
+    /// The scalar dimension of a key, used to estimate the cost of elimination
+    static size_t KeyDimension(const FactorType& factor, FactorType::const_iterator key) {
+      return factor.getDim(key); }
   };
 
   /* ************************************************************************* */
@@ -281,16 +284,20 @@ namespace gtsam {
     /** Solve the factor graph by performing multifrontal variable elimination in COLAMD order using
      *  the dense elimination function specified in \c function (default EliminatePreferCholesky),
      *  followed by back-substitution in the Bayes tree resulting from elimination.  Is equivalent
-     *  to calling graph.eliminateMultifrontal()->optimize(). */
+     *  to calling graph.eliminateMultifrontal()->optimize().  With TBB, subtrees whose estimated
+     *  elimination cost is below \c parallelCostThreshold are eliminated in a single task. */
     VectorValues optimize(
-      const Eliminate& function = EliminationTraitsType::DefaultEliminate) const;
+      const Eliminate& function = EliminationTraitsType::DefaultEliminate,
+      double parallelCostThreshold = 1e5) const;
 
     /** Solve the factor graph by performing multifrontal variable elimination in COLAMD order using
      *  the dense elimination function specified in \c function (default EliminatePreferCholesky),
      *  followed by back-substitution in the Bayes tree resulting from elimination.  Is equivalent
-     *  to calling graph.eliminateMultifrontal()->optimize(). */
+     *  to calling graph.eliminateMultifrontal()->optimize().  With TBB, subtrees whose estimated
+     *  elimination cost is below \c parallelCostThreshold are eliminated in a single task. */
     VectorValues optimize(const Ordering&,
-      const Eliminate& function = EliminationTraitsType::DefaultEliminate) const;
+      const Eliminate& function = EliminationTraitsType::DefaultEliminate,
+      double parallelCostThreshold = 1e5) const;
 
     /**
      * Optimize using Eigen's dense Cholesky factorization
@@ -65,48 +65,29 @@ GaussianFactorGraphSystem::GaussianFactorGraphSystem(
     const GaussianFactorGraph &gfg, const Preconditioner &preconditioner,
     const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda) :
     gfg_(gfg), preconditioner_(preconditioner), keyInfo_(keyInfo), lambda_(
-        lambda) {
+        lambda), blockSparse_(gfg, keyInfo) {
 }
 
 /*****************************************************************************/
 void GaussianFactorGraphSystem::residual(const Vector &x, Vector &r) const {
   /* implement b-Ax, assume x and r are pre-allocated */
 
-  /* reset r to b */
-  getb(r);
-
-  /* substract A*x */
-  Vector Ax = Vector::Zero(r.rows(), 1);
+  /* substract A*x from b */
+  Vector Ax;
   multiply(x, Ax);
-  r -= Ax;
+  r = blockSparse_.rhs() - Ax;
 }
 
 /*****************************************************************************/
 void GaussianFactorGraphSystem::multiply(const Vector &x, Vector& AtAx) const {
-  /* implement A^T*(A*x), assume x and AtAx are pre-allocated */
-
-  // Build a VectorValues for Vector x
-  VectorValues vvX = buildVectorValues(x, keyInfo_);
-
-  // VectorValues form of A'Ax for multiplyHessianAdd
-  VectorValues vvAtAx = keyInfo_.x0(); // crucial for performance
-
-  // vvAtAx += 1.0 * A'Ax for each factor
-  gfg_.multiplyHessianAdd(1.0, vvX, vvAtAx);
-
-  // Make the result as Vector form
-  AtAx = vvAtAx.vector(keyInfo_.ordering());
+  /* implement A^T*(A*x) on the flat blocks, without converting to VectorValues */
+  blockSparse_.multiply(x, AtAx);
 }
 
 /*****************************************************************************/
 void GaussianFactorGraphSystem::getb(Vector &b) const {
-  /* compute rhs, assume b pre-allocated */
-
-  // Get whitened r.h.s (A^T * b) from each factor in the form of VectorValues
-  VectorValues vvb = gfg_.gradientAtZero();
-
-  // Make the result as Vector form
-  b = -vvb.vector(keyInfo_.ordering());
+  /* whitened r.h.s (A^T * b), computed once when the system was built */
+  b = blockSparse_.rhs();
 }
 
 /**********************************************************************************/
@@ -125,6 +106,13 @@ void GaussianFactorGraphSystem::rightPrecondition(const Vector &x,
   preconditioner_.transposeSolve(x, y);
 }
 
+/**********************************************************************************/
+void GaussianFactorGraphSystem::precondition(const Vector &x, Vector &y) const {
+  // For a preconditioner M = L*L^T
+  // Calculate y = M^{-1} x
+  preconditioner_.fullSolve(x, y);
+}
+
 /**********************************************************************************/
 VectorValues buildVectorValues(const Vector &v, const Ordering &ordering,
     const map<Key, size_t> & dimensions) {
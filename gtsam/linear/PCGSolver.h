@@ -20,6 +20,7 @@
 #pragma once
 
 #include <gtsam/linear/ConjugateGradientSolver.h>
+#include <gtsam/linear/BlockSparseOperator.h>
 #include <string>
 
 namespace gtsam {
@@ -92,11 +93,13 @@ public:
   const Preconditioner &preconditioner_;
   const KeyInfo &keyInfo_;
   const std::map<Key, Vector> &lambda_;
+  BlockSparseOperator blockSparse_; ///< A'A and A'b of gfg_, built once for all iterations
 
   void residual(const Vector &x, Vector &r) const;
   void multiply(const Vector &x, Vector& y) const;
   void leftPrecondition(const Vector &x, Vector &y) const;
   void rightPrecondition(const Vector &x, Vector &y) const;
+  void precondition(const Vector &x, Vector &y) const;
   inline void scal(const double alpha, Vector &x) const {
     x *= alpha;
   }
@@ -8,6 +8,7 @@
 
 #include <gtsam/inference/FactorGraph-inst.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/IterativeSolver.h>
 #include <gtsam/linear/PCGSolver.h>
 #include <gtsam/linear/Preconditioner.h>
 #include <gtsam/linear/SubgraphPreconditioner.h>
@@ -16,6 +17,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 using namespace std;
@@ -182,6 +184,350 @@ void BlockJacobiPreconditioner::clean() {
   }
 }
 
+/***************************************************************************************/
+namespace {
+
+typedef std::vector<std::map<size_t, Matrix> > BlockRows;
+
+/* Add a block at (i,j) of a block-sparse matrix, creating it if needed */
+void addBlock(BlockRows &rows, size_t i, size_t j, const Matrix &block) {
+  std::map<size_t, Matrix>::iterator it = rows[i].find(j);
+  if (it == rows[i].end())
+    rows[i].emplace(j, block);
+  else
+    it->second += block;
+}
+
+/* The full block-sparse Hessian of a factor graph, with the variables ordered as in keyInfo */
+BlockRows blockHessian(const GaussianFactorGraph &gfg, const KeyInfo &keyInfo) {
+  BlockRows rows(keyInfo.size());
+  for (const GaussianFactor::shared_ptr &factor : gfg) {
+    if (!factor) continue;
+    const Matrix information = factor->information();
+    std::vector<size_t> indices, offsets, dims;
+    size_t offset = 0;
+    for (GaussianFactor::const_iterator key = factor->begin(); key != factor->end(); ++key) {
+      indices.push_back(keyInfo.at(*key).index);
+      offsets.push_back(offset);
+      dims.push_back(factor->getDim(key));
+      offset += dims.back();
+    }
+    for (size_t a = 0; a < indices.size(); ++a)
+      for (size_t b = 0; b < indices.size(); ++b)
+        addBlock(rows, indices[a], indices[b],
+                 information.block(offsets[a], offsets[b], dims[a], dims[b]));
+  }
+  return rows;
+}
+
+/* Offsets of blocks of the given dimensions in a flat vector */
+std::vector<size_t> blockStarts(const std::vector<size_t> &dims) {
+  std::vector<size_t> starts(dims.size());
+  size_t start = 0;
+  for (size_t i = 0; i < dims.size(); ++i) {
+    starts[i] = start;
+    start += dims[i];
+  }
+  return starts;
+}
+
+}  // namespace
+
+/***************************************************************************************/
+void IncompleteCholeskyPreconditioner::solve(const Vector& y, Vector &x) const {
+  /* forward substitution with L */
+  x = y;
+  for (size_t i = 0; i < L_.size(); ++i) {
+    Eigen::VectorBlock<Vector> xi = x.segment(starts_[i], dims_[i]);
+    for (const std::pair<const size_t, Matrix> &Lij : L_[i]) {
+      const size_t j = Lij.first;
+      if (j == i) break;
+      xi.noalias() -= Lij.second * x.segment(starts_[j], dims_[j]);
+    }
+    L_[i].rbegin()->second.triangularView<Eigen::Lower>().solveInPlace(xi);
+  }
+}
+
+/***************************************************************************************/
+void IncompleteCholeskyPreconditioner::transposeSolve(const Vector& y, Vector& x) const {
+  /* backward substitution with L^T, one block column of L^T at a time */
+  x = y;
+  for (size_t i = L_.size(); i-- > 0;) {
+    Eigen::VectorBlock<Vector> xi = x.segment(starts_[i], dims_[i]);
+    L_[i].rbegin()->second.transpose().triangularView<Eigen::Upper>().solveInPlace(xi);
+    for (const std::pair<const size_t, Matrix> &Lij : L_[i]) {
+      const size_t j = Lij.first;
+      if (j == i) break;
+      x.segment(starts_[j], dims_[j]).noalias() -= Lij.second.transpose() * xi;
+    }
+  }
+}
+
+/***************************************************************************************/
+void IncompleteCholeskyPreconditioner::build(
+  const GaussianFactorGraph &gfg, const KeyInfo &keyInfo, const std::map<Key,Vector> &lambda)
+{
+  dims_ = keyInfo.colSpec();
+  starts_ = blockStarts(dims_);
+  const size_t n = dims_.size();
+  const BlockRows H = blockHessian(gfg, keyInfo);
+
+  /* factorize row by row, retrying with a larger diagonal shift on breakdown */
+  for (double shift = 0.0; shift <= 1e6; shift = (shift == 0.0) ? 1e-3 : 10.0 * shift) {
+    L_.assign(n, std::map<size_t, Matrix>());
+    bool success = true;
+    for (size_t i = 0; i < n && success; ++i) {
+      std::map<size_t, Matrix> &Li = L_[i];
+      for (const std::pair<const size_t, Matrix> &Hij : H[i]) {
+        const size_t j = Hij.first;
+        if (j > i) break;
+        Matrix S = Hij.second;
+        if (j < i) {
+          /* L_ij = (H_ij - sum_k L_ik L_jk^T) L_jj^{-T}, over the k < j in both rows */
+          const std::map<size_t, Matrix> &Lj = L_[j];
+          for (const std::pair<const size_t, Matrix> &Ljk : Lj) {
+            if (Ljk.first == j) break;
+            std::map<size_t, Matrix>::const_iterator Lik = Li.find(Ljk.first);
+            if (Lik != Li.end())
+              S.noalias() -= Lik->second * Ljk.second.transpose();
+          }
+          const Matrix &Ljj = Lj.rbegin()->second;
+          Li.emplace(j, Ljj.triangularView<Eigen::Lower>().solve(S.transpose()).transpose());
+        } else {
+          /* L_ii = chol(H_ii - sum_k L_ik L_ik^T) */
+          S.diagonal() *= 1.0 + shift;
+          for (const std::pair<const size_t, Matrix> &Lik : Li)
+            S.noalias() -= Lik.second * Lik.second.transpose();
+          const Eigen::LLT<Matrix> llt(S);
+          if (llt.info() != Eigen::Success) {
+            success = false;
+            break;
+          }
+          Li.emplace(i, llt.matrixL());
+        }
+      }
+    }
+    if (success) return;
+  }
+  throw std::runtime_error(
+      "IncompleteCholeskyPreconditioner::build: the Hessian is not positive definite");
+}
+
+/***************************************************************************************/
+void MultilevelPreconditionerParameters::print(ostream &os) const {
+  Base::print(os);
+  os << "maxLevels:     " << maxLevels_ << endl
+     << "coarsestSize:  " << coarsestSize_ << endl;
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::solve(const Vector& y, Vector &x) const {
+  x = Vector::Zero(factorCols_);
+  factorTranspose(0, y, x, 0);
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::transposeSolve(const Vector& y, Vector &x) const {
+  factor(0, y, 0, x);
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::fullSolve(const Vector& y, Vector &x) const {
+  vcycle(0, y, x);
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::relax(size_t l, size_t i, const Vector& b, Vector& x) const {
+  /* x_i = A_ii^{-1} (b_i - sum_{j != i} A_ij x_j) */
+  const Level &level = levels_[l];
+  Vector ri = b.segment(level.starts[i], level.dims[i]);
+  for (const std::pair<const size_t, Matrix> &Aij : level.A[i])
+    if (Aij.first != i)
+      ri.noalias() -= Aij.second * x.segment(level.starts[Aij.first], level.dims[Aij.first]);
+  x.segment(level.starts[i], level.dims[i]).noalias() = level.inverseDiagonal[i] * ri;
+}
+
+/***************************************************************************************/
+Vector MultilevelPreconditioner::restrictResidual(size_t l, const Vector& b,
+                                                  const Vector& x) const {
+  /* P^T (b - A x), summing the residual over each aggregate */
+  const Level &level = levels_[l], &coarse = levels_[l + 1];
+  Vector coarseResidual = Vector::Zero(coarse.cols());
+  for (size_t i = 0; i < level.dims.size(); ++i) {
+    Vector ri = b.segment(level.starts[i], level.dims[i]);
+    for (const std::pair<const size_t, Matrix> &Aij : level.A[i])
+      ri.noalias() -= Aij.second * x.segment(level.starts[Aij.first], level.dims[Aij.first]);
+    coarseResidual.segment(coarse.starts[level.aggregates[i]], level.dims[i]) += ri;
+  }
+  return coarseResidual;
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::prolong(size_t l, const Vector& coarseX, Vector& x) const {
+  /* x += P x_c, copying the value of each aggregate to its variables */
+  const Level &level = levels_[l], &coarse = levels_[l + 1];
+  for (size_t i = 0; i < level.dims.size(); ++i)
+    x.segment(level.starts[i], level.dims[i]) +=
+        coarseX.segment(coarse.starts[level.aggregates[i]], level.dims[i]);
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::vcycle(size_t l, const Vector& b, Vector& x) const {
+  if (l + 1 == levels_.size()) {
+    x = coarsestInverse_ * b;
+    return;
+  }
+  const size_t n = levels_[l].dims.size();
+
+  /* pre-smoothing with a forward Gauss-Seidel sweep */
+  x = Vector::Zero(b.size());
+  for (size_t i = 0; i < n; ++i) relax(l, i, b, x);
+
+  /* correct on the coarser level */
+  Vector coarseCorrection;
+  vcycle(l + 1, restrictResidual(l, b, x), coarseCorrection);
+  prolong(l, coarseCorrection, x);
+
+  /* post-smoothing with a backward Gauss-Seidel sweep, to keep the V-cycle symmetric */
+  for (size_t i = n; i-- > 0;) relax(l, i, b, x);
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::factorTranspose(size_t l, const Vector& b, Vector& x,
+                                               size_t offset) const {
+  const Level &level = levels_[l];
+  if (l + 1 == levels_.size()) {
+    x.segment(offset, level.cols()) = coarsestFactor_.triangularView<Eigen::Lower>().solve(b);
+    return;
+  }
+
+  /* s = S b, with S = (D + L)^{-1} a forward sweep from zero, and L_D^T s for this level */
+  Vector s = Vector::Zero(b.size());
+  for (size_t i = 0; i < level.dims.size(); ++i) relax(l, i, b, s);
+  for (size_t i = 0; i < level.dims.size(); ++i)
+    x.segment(offset + level.starts[i], level.dims[i]).noalias() =
+        level.diagonalFactor[i].transpose() * s.segment(level.starts[i], level.dims[i]);
+
+  /* C_c^T P^T (I - A S) b for the coarser levels */
+  factorTranspose(l + 1, restrictResidual(l, b, s), x, offset + level.cols());
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::factor(size_t l, const Vector& y, size_t offset,
+                                      Vector& x) const {
+  const Level &level = levels_[l];
+  if (l + 1 == levels_.size()) {
+    x = coarsestFactor_.transpose().triangularView<Eigen::Upper>().solve(
+        y.segment(offset, level.cols()));
+    return;
+  }
+
+  /* w = P C_c y_c for the coarser levels */
+  Vector coarseW, w = Vector::Zero(level.cols());
+  factor(l + 1, y, offset + level.cols(), coarseW);
+  prolong(l, coarseW, w);
+
+  /* x = w + S^T (L_D y_l - A w), with S^T = (D + U)^{-1} a backward sweep from zero */
+  Vector v(level.cols());
+  for (size_t i = 0; i < level.dims.size(); ++i) {
+    Vector vi = level.diagonalFactor[i] * y.segment(offset + level.starts[i], level.dims[i]);
+    for (const std::pair<const size_t, Matrix> &Aij : level.A[i])
+      vi.noalias() -= Aij.second * w.segment(level.starts[Aij.first], level.dims[Aij.first]);
+    v.segment(level.starts[i], level.dims[i]) = vi;
+  }
+  x = Vector::Zero(level.cols());
+  for (size_t i = level.dims.size(); i-- > 0;) relax(l, i, v, x);
+  x += w;
+}
+
+/***************************************************************************************/
+void MultilevelPreconditioner::build(
+  const GaussianFactorGraph &gfg, const KeyInfo &keyInfo, const std::map<Key,Vector> &lambda)
+{
+  levels_.assign(1, Level());
+  levels_[0].dims = keyInfo.colSpec();
+  levels_[0].starts = blockStarts(levels_[0].dims);
+  levels_[0].A = blockHessian(gfg, keyInfo);
+
+  while (levels_.size() < parameters_.maxLevels_ &&
+         levels_.back().dims.size() > parameters_.coarsestSize_) {
+    Level &fine = levels_.back();
+    const size_t n = fine.dims.size(), free = n;
+    std::vector<size_t> &aggregates = fine.aggregates;
+    aggregates.assign(n, free);
+    size_t nrAggregates = 0;
+
+    /* a variable whose neighbors of the same dimension are all free starts an aggregate with them */
+    for (size_t i = 0; i < n; ++i) {
+      if (aggregates[i] != free) continue;
+      bool allFree = true;
+      for (const std::pair<const size_t, Matrix> &Aij : fine.A[i])
+        if (fine.dims[Aij.first] == fine.dims[i] && aggregates[Aij.first] != free) {
+          allFree = false;
+          break;
+        }
+      if (!allFree) continue;
+      for (const std::pair<const size_t, Matrix> &Aij : fine.A[i])
+        if (fine.dims[Aij.first] == fine.dims[i])
+          aggregates[Aij.first] = nrAggregates;
+      ++nrAggregates;
+    }
+
+    /* the remaining variables join a neighboring aggregate of the same dimension */
+    for (size_t i = 0; i < n; ++i) {
+      if (aggregates[i] != free) continue;
+      for (const std::pair<const size_t, Matrix> &Aij : fine.A[i])
+        if (fine.dims[Aij.first] == fine.dims[i] && aggregates[Aij.first] != free) {
+          aggregates[i] = aggregates[Aij.first];
+          break;
+        }
+      if (aggregates[i] == free)
+        aggregates[i] = nrAggregates++;
+    }
+
+    if (nrAggregates == n) {
+      aggregates.clear();
+      break;
+    }
+
+    /* the coarse Hessian P^T A P sums the blocks of each pair of aggregates */
+    Level coarse;
+    coarse.dims.resize(nrAggregates);
+    for (size_t i = 0; i < n; ++i)
+      coarse.dims[aggregates[i]] = fine.dims[i];
+    coarse.starts = blockStarts(coarse.dims);
+    coarse.A.resize(nrAggregates);
+    for (size_t i = 0; i < n; ++i)
+      for (const std::pair<const size_t, Matrix> &Aij : fine.A[i])
+        addBlock(coarse.A, aggregates[i], aggregates[Aij.first], Aij.second);
+    levels_.push_back(coarse);
+  }
+
+  /* factor and invert the diagonal blocks for the smoother, and the whole coarsest level */
+  factorCols_ = 0;
+  for (size_t l = 0; l + 1 < levels_.size(); ++l) {
+    Level &level = levels_[l];
+    level.diagonalFactor.resize(level.dims.size());
+    level.inverseDiagonal.resize(level.dims.size());
+    for (size_t i = 0; i < level.dims.size(); ++i) {
+      const Eigen::LLT<Matrix> llt(level.A[i].at(i));
+      level.diagonalFactor[i] = llt.matrixL();
+      level.inverseDiagonal[i] = llt.solve(Matrix::Identity(level.dims[i], level.dims[i]));
+    }
+    factorCols_ += level.cols();
+  }
+  const Level &coarsest = levels_.back();
+  Matrix dense = Matrix::Zero(coarsest.cols(), coarsest.cols());
+  for (size_t i = 0; i < coarsest.dims.size(); ++i)
+    for (const std::pair<const size_t, Matrix> &Aij : coarsest.A[i])
+      dense.block(coarsest.starts[i], coarsest.starts[Aij.first], coarsest.dims[i],
+                  coarsest.dims[Aij.first]) = Aij.second;
+  const Eigen::LLT<Matrix> llt(dense);
+  coarsestFactor_ = llt.matrixL();
+  coarsestInverse_ = llt.solve(Matrix::Identity(dense.rows(), dense.cols()));
+  factorCols_ += coarsest.cols();
+}
+
 /***************************************************************************************/
 boost::shared_ptr<Preconditioner> createPreconditioner(
     const boost::shared_ptr<PreconditionerParameters> params) {
@@ -191,6 +537,13 @@ boost::shared_ptr<Preconditioner> createPreconditioner(
   } else if (dynamic_pointer_cast<BlockJacobiPreconditionerParameters>(
                  params)) {
     return boost::make_shared<BlockJacobiPreconditioner>();
+  } else if (dynamic_pointer_cast<IncompleteCholeskyPreconditionerParameters>(
+                 params)) {
+    return boost::make_shared<IncompleteCholeskyPreconditioner>();
+  } else if (auto multilevel =
+                 dynamic_pointer_cast<MultilevelPreconditionerParameters>(
+                     params)) {
+    return boost::make_shared<MultilevelPreconditioner>(*multilevel);
   } else if (auto subgraph =
                  dynamic_pointer_cast<SubgraphPreconditionerParameters>(
                      params)) {
@@ -8,11 +8,13 @@
 
 #pragma once
 
+#include <gtsam/base/Matrix.h>
 #include <gtsam/base/Vector.h>
 #include <boost/shared_ptr.hpp>
 #include <iosfwd>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace gtsam {
 
@@ -83,6 +85,13 @@ public:
   /// implement x = L^{-T} y
   virtual void transposeSolve(const Vector& y, Vector& x) const = 0;
 
+  /// implement x = M^{-1} y = L^{-T} L^{-1} y, as used by preconditionedConjugateGradient
+  virtual void fullSolve(const Vector& y, Vector& x) const {
+    Vector z(y.size());  // solve and transposeSolve may expect preallocated outputs
+    solve(y, z);
+    transposeSolve(z, x);
+  }
+
   /// build/factorize the preconditioner
   virtual void build(
     const GaussianFactorGraph &gfg,
@@ -153,6 +162,132 @@ protected:
   size_t nnz_;
 };
 
+/*******************************************************************************************/
+struct GTSAM_EXPORT IncompleteCholeskyPreconditionerParameters : public PreconditionerParameters {
+  typedef PreconditionerParameters Base;
+  IncompleteCholeskyPreconditionerParameters() : Base() {}
+  virtual ~IncompleteCholeskyPreconditionerParameters() {}
+};
+
+/*******************************************************************************************/
+/**
+ * Block incomplete Cholesky factorization IC(0) of the Hessian: M = L*L^T, where L has the
+ * block-sparsity pattern of the lower triangle of the Hessian, with one dense block per pair of
+ * variables that share a factor, ordered as in KeyInfo. Fill-in outside that pattern is dropped.
+ * If a diagonal block breaks down, the factorization is restarted with the diagonal of the
+ * Hessian scaled up by an increasing shift, as in Manteuffel's shifted incomplete Cholesky.
+ */
+class GTSAM_EXPORT IncompleteCholeskyPreconditioner : public Preconditioner {
+public:
+  typedef Preconditioner Base;
+  IncompleteCholeskyPreconditioner() : Base() {}
+  virtual ~IncompleteCholeskyPreconditioner() {}
+
+  /* Computation Interfaces for raw vector */
+  virtual void solve(const Vector& y, Vector &x) const;
+  virtual void transposeSolve(const Vector& y, Vector& x) const;
+  virtual void build(
+    const GaussianFactorGraph &gfg,
+    const KeyInfo &info,
+    const std::map<Key,Vector> &lambda
+    );
+
+protected:
+
+  std::vector<size_t> dims_, starts_;        ///< dimension and offset of each variable
+  std::vector<std::map<size_t, Matrix> > L_; ///< block rows of L, including the diagonal
+};
+
+/*******************************************************************************************/
+struct GTSAM_EXPORT MultilevelPreconditionerParameters : public PreconditionerParameters {
+  typedef PreconditionerParameters Base;
+  size_t maxLevels_;    ///< maximum number of levels, including the finest and the coarsest
+  size_t coarsestSize_; ///< stop coarsening once a level has at most this many variables
+
+  MultilevelPreconditionerParameters(size_t maxLevels = 10, size_t coarsestSize = 64)
+    : Base(), maxLevels_(maxLevels), coarsestSize_(coarsestSize) {}
+  virtual ~MultilevelPreconditionerParameters() {}
+
+  using Base::print;
+  virtual void print(std::ostream &os) const;
+};
+
+/*******************************************************************************************/
+/**
+ * Algebraic multilevel preconditioner for the Hessian, applied as one symmetric V-cycle.
+ *
+ * Coarse levels are built by aggregation over the graph of the variables: each variable is
+ * grouped with its free neighbors of the same dimension, which for a pose graph merges runs of
+ * consecutive poses, and the coarse Hessian is the sum of the blocks of each aggregate. Each
+ * level is smoothed with one forward block Gauss-Seidel sweep before, and one backward sweep
+ * after the coarse correction, and the coarsest level is solved directly.
+ *
+ * fullSolve applies the V-cycle, a symmetric approximation B of M^{-1}. solve and transposeSolve
+ * apply a factorization B = L^{-T} L^{-1}, for which L is not square: with the forward sweep
+ * S = (D + L_A)^{-1} of a level and the Cholesky factor L_D of its block diagonal,
+ *   L^{-T} = [ S^T L_D,  (I - S^T A) P C ]
+ * where P sums over the aggregates and C is L^{-T} of the coarser levels, or the inverse
+ * transposed Cholesky factor of the coarsest one. solve hence returns a vector with the
+ * dimensions of all levels together, and transposeSolve takes one.
+ */
+class GTSAM_EXPORT MultilevelPreconditioner : public Preconditioner {
+public:
+  typedef Preconditioner Base;
+  MultilevelPreconditioner(
+      const MultilevelPreconditionerParameters &p = MultilevelPreconditionerParameters())
+    : Base(), parameters_(p), factorCols_(0) {}
+  virtual ~MultilevelPreconditioner() {}
+
+  /* Computation Interfaces for raw vector */
+  virtual void solve(const Vector& y, Vector &x) const;
+  virtual void transposeSolve(const Vector& y, Vector& x) const;
+  virtual void fullSolve(const Vector& y, Vector& x) const;
+  virtual void build(
+    const GaussianFactorGraph &gfg,
+    const KeyInfo &info,
+    const std::map<Key,Vector> &lambda
+    );
+
+  /// The number of levels built, including the finest and the coarsest
+  size_t nrLevels() const { return levels_.size(); }
+
+protected:
+
+  /* One level of the hierarchy, level 0 being the original system */
+  struct Level {
+    std::vector<size_t> dims, starts;          ///< dimension and offset of each variable
+    std::vector<std::map<size_t, Matrix> > A;  ///< block rows of the symmetric Hessian
+    std::vector<Matrix> diagonalFactor;        ///< lower Cholesky factors of the diagonal blocks
+    std::vector<Matrix> inverseDiagonal;       ///< inverses of the diagonal blocks
+    std::vector<size_t> aggregates;            ///< variable in the next level of each variable
+    size_t cols() const { return dims.empty() ? 0 : starts.back() + dims.back(); }
+  };
+
+  /* Relax variable i of level l with the right-hand side b, one Gauss-Seidel step */
+  void relax(size_t l, size_t i, const Vector& b, Vector& x) const;
+
+  /* Restrict the residual b - A x of level l to level l + 1 */
+  Vector restrictResidual(size_t l, const Vector& b, const Vector& x) const;
+
+  /* Add the prolongation of a correction on level l + 1 to x on level l */
+  void prolong(size_t l, const Vector& coarseX, Vector& x) const;
+
+  /* Apply the V-cycle from level l down to the right-hand side b */
+  void vcycle(size_t l, const Vector& b, Vector& x) const;
+
+  /* Write L^{-1} b of levels l and below into x, starting at offset */
+  void factorTranspose(size_t l, const Vector& b, Vector& x, size_t offset) const;
+
+  /* x = L^{-T} y of levels l and below, reading y from offset */
+  void factor(size_t l, const Vector& y, size_t offset, Vector& x) const;
+
+  MultilevelPreconditionerParameters parameters_;
+  std::vector<Level> levels_;
+  Matrix coarsestInverse_;                     ///< dense inverse of the coarsest Hessian
+  Matrix coarsestFactor_;                      ///< lower Cholesky factor of the coarsest Hessian
+  size_t factorCols_;                          ///< number of rows of L^{-1}, over all levels
+};
+
 /*********************************************************************************************/
 /* factory method to create preconditioners */
 boost::shared_ptr<Preconditioner> createPreconditioner(const boost::shared_ptr<PreconditionerParameters> parameters);
@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file SparseCholeskySolver.cpp
+ * @brief Direct solver that factorizes the sparse Hessian in compressed-column form
+ * @date Oct 2026
+ */
+
+#include <gtsam/linear/SparseCholeskySolver.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/linear/linearExceptions.h>
+#include <gtsam/inference/inferenceExceptions.h>
+#include <gtsam/base/FastMap.h>
+#include <gtsam/base/timing.h>
+
+#include <Eigen/SparseCore>
+#include <Eigen/SparseCholesky>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+namespace gtsam {
+
+  typedef Eigen::SparseMatrix<double, Eigen::ColMajor, int> SparseMatrix;
+
+  // Pivots smaller than this fraction of their diagonal entry are treated as zero
+  static const double zeroPivotTolerance = 1e-10;
+
+  /* ************************************************************************* */
+  struct SparseCholeskySolver::Factorization {
+    // The columns are already laid out in a fill-reducing ordering, so do not permute again
+    Eigen::SimplicialLDLT<SparseMatrix, Eigen::Upper, Eigen::NaturalOrdering<int> > ldlt;
+
+    // Sparsity pattern of the Hessian that was last analyzed
+    vector<int> outerIndices, innerIndices;
+
+    bool samePattern(const SparseMatrix& H) const {
+      return outerIndices.size() == size_t(H.outerSize() + 1) &&
+             innerIndices.size() == size_t(H.nonZeros()) &&
+             equal(outerIndices.begin(), outerIndices.end(), H.outerIndexPtr()) &&
+             equal(innerIndices.begin(), innerIndices.end(), H.innerIndexPtr());
+    }
+
+    void analyzePattern(const SparseMatrix& H) {
+      gttic(SparseCholeskySolver_analyzePattern);
+      ldlt.analyzePattern(H);
+      outerIndices.assign(H.outerIndexPtr(), H.outerIndexPtr() + H.outerSize() + 1);
+      innerIndices.assign(H.innerIndexPtr(), H.innerIndexPtr() + H.nonZeros());
+    }
+  };
+
+  /* ************************************************************************* */
+  SparseCholeskySolver::SparseCholeskySolver(const Ordering& ordering) :
+    ordering_(ordering), factorization_(boost::make_shared<Factorization>()) {}
+
+  /* ************************************************************************* */
+  VectorValues SparseCholeskySolver::optimize(const GaussianFactorGraph& gfg) {
+    gttic(SparseCholeskySolver_optimize);
+
+    if (hasConstraints(gfg))
+      throw invalid_argument(
+          "SparseCholeskySolver: constrained noise models are not supported, use QR instead");
+
+    // Find the dimension of each variable
+    FastMap<Key, size_t> dims;
+    for (const GaussianFactor::shared_ptr& factor : gfg) {
+      if (!factor)
+        continue;
+      for (GaussianFactor::const_iterator key = factor->begin(); key != factor->end(); ++key)
+        dims[*key] = factor->getDim(key);
+    }
+
+    // Lay out the columns of the Hessian in the given ordering
+    FastMap<Key, size_t> columns;
+    vector<size_t> firstColumns;
+    firstColumns.reserve(ordering_.size());
+    size_t n = 0;
+    for (Key key : ordering_) {
+      const auto dim = dims.find(key);
+      if (dim == dims.end())
+        throw invalid_argument(
+            "SparseCholeskySolver: ordering contains variables that are not involved in the "
+            "factor graph");
+      columns.insert(make_pair(key, n));
+      firstColumns.push_back(n);
+      n += dim->second;
+    }
+    if (dims.size() != ordering_.size())
+      throw InconsistentEliminationRequested();
+
+    // Assemble the upper triangle of the Hessian, and the information vector
+    gttic(assemble);
+    vector<Eigen::Triplet<double> > triplets;
+    Vector eta = Vector::Zero(n);
+    FastVector<size_t> localColumns, globalColumns, blockDims;
+    for (const GaussianFactor::shared_ptr& factor : gfg) {
+      if (!factor)
+        continue;
+      const Matrix info = factor->augmentedInformation();
+      const DenseIndex last = info.cols() - 1;
+
+      localColumns.clear();
+      globalColumns.clear();
+      blockDims.clear();
+      size_t localColumn = 0;
+      for (GaussianFactor::const_iterator key = factor->begin(); key != factor->end(); ++key) {
+        localColumns.push_back(localColumn);
+        globalColumns.push_back(columns.at(*key));
+        blockDims.push_back(factor->getDim(key));
+        localColumn += blockDims.back();
+      }
+
+      for (size_t i = 0; i < factor->size(); ++i) {
+        for (size_t j = 0; j < factor->size(); ++j) {
+          if (globalColumns[i] > globalColumns[j])
+            continue;  // only blocks on or above the diagonal
+          for (size_t c = 0; c < blockDims[j]; ++c) {
+            for (size_t r = 0; r < blockDims[i]; ++r) {
+              const size_t row = globalColumns[i] + r, col = globalColumns[j] + c;
+              if (row <= col)
+                triplets.emplace_back(int(row), int(col),
+                                      info(localColumns[i] + r, localColumns[j] + c));
+            }
+          }
+        }
+        eta.segment(globalColumns[i], blockDims[i]) +=
+            info.block(localColumns[i], last, blockDims[i], 1);
+      }
+    }
+    SparseMatrix H(n, n);
+    H.setFromTriplets(triplets.begin(), triplets.end());
+    gttoc(assemble);
+
+    // Factorize, re-using the symbolic analysis if the sparsity pattern did not change
+    if (!factorization_->samePattern(H))
+      factorization_->analyzePattern(H);
+    gttic(factorize);
+    factorization_->ldlt.factorize(H);
+    gttoc(factorize);
+
+    // A pivot that vanishes relative to its diagonal entry means the system is indeterminant,
+    // report the variable it belongs to
+    const Vector& D = factorization_->ldlt.vectorD();
+    const Vector diagonal = H.diagonal();
+    for (DenseIndex k = 0; k < DenseIndex(n); ++k) {
+      if (!(D(k) > zeroPivotTolerance * diagonal(k))) {
+        const size_t i =
+            upper_bound(firstColumns.begin(), firstColumns.end(), size_t(k)) - firstColumns.begin();
+        throw IndeterminantLinearSystemException(ordering_[i - 1]);
+      }
+    }
+    if (factorization_->ldlt.info() != Eigen::Success)
+      throw IndeterminantLinearSystemException(ordering_.back());
+
+    // Back-substitute and split the solution into variables
+    gttic(solve);
+    const Vector x = factorization_->ldlt.solve(eta);
+    VectorValues result;
+    for (size_t i = 0; i < ordering_.size(); ++i)
+      result.emplace(ordering_[i], x.segment(firstColumns[i], dims.at(ordering_[i])));
+    return result;
+  }
+
+}
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file SparseCholeskySolver.h
+ * @brief Direct solver that factorizes the sparse Hessian in compressed-column form
+ * @date Oct 2026
+ */
+
+#pragma once
+
+#include <gtsam/inference/Ordering.h>
+
+#include <boost/shared_ptr.hpp>
+
+namespace gtsam {
+
+  // Forward declarations
+  class GaussianFactorGraph;
+  class VectorValues;
+
+  /**
+   * Solves a GaussianFactorGraph by assembling the whitened Hessian \f$ A^T A \f$ and the
+   * information vector \f$ A^T b \f$ into a compressed-column sparse matrix and factorizing it
+   * with the sparse Cholesky (LDL') decomposition of the bundled Eigen. The columns are laid
+   * out in the given fill-reducing ordering, so no clique structure is built at all, which is
+   * a useful comparison point for GaussianJunctionTree on graphs that cluster poorly.
+   *
+   * This is the solver used when NonlinearOptimizerParams::linearSolverType is CHOLMOD. As in
+   * Cholesky elimination, constrained noise models are not supported.
+   *
+   * The symbolic analysis is cached, and re-used as long as the sparsity pattern of the
+   * Hessian does not change between calls to optimize.
+   */
+  class GTSAM_EXPORT SparseCholeskySolver {
+  public:
+    typedef boost::shared_ptr<SparseCholeskySolver> shared_ptr;
+
+    /// Construct with the ordering in which the Hessian columns are laid out
+    explicit SparseCholeskySolver(const Ordering& ordering);
+
+    /// Solve the least-squares problem defined by the factor graph
+    VectorValues optimize(const GaussianFactorGraph& gfg);
+
+    /// Return the ordering
+    const Ordering& ordering() const { return ordering_; }
+
+  private:
+    struct Factorization;  ///< Cached Eigen factorization and sparsity pattern
+
+    Ordering ordering_;
+    boost::shared_ptr<Factorization> factorization_;
+  };
+
+}
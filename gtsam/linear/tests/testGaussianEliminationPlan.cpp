@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testGaussianEliminationPlan.cpp
+ * @brief Unit tests for GaussianEliminationPlan
+ * @date Oct 2026
+ */
+
+#include <gtsam/linear/GaussianEliminationPlan.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <boost/assign/list_of.hpp>
+using boost::assign::list_of;
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+  const Key x1 = 1, x2 = 2, x3 = 3, x4 = 4;
+  const SharedDiagonal chainNoise = noiseModel::Isotropic::Sigma(1, 0.5);
+
+  // A chain x1 - x2 - x3 - x4, scaled to get graphs with the same structure
+  GaussianFactorGraph Chain(double scale) {
+    GaussianFactorGraph chain;
+    chain += JacobianFactor(x2, I_1x1, x1, scale * I_1x1, Vector1(1.), chainNoise);
+    chain += JacobianFactor(x2, I_1x1, x3, scale * I_1x1, Vector1(scale), chainNoise);
+    chain += JacobianFactor(x3, I_1x1, x4, I_1x1, Vector1(1.), chainNoise);
+    chain += JacobianFactor(x4, scale * I_1x1, Vector1(1.), chainNoise);
+    return chain;
+  }
+  const Ordering chainOrdering = Ordering(list_of(x2)(x1)(x3)(x4));
+}
+
+/* ************************************************************************* */
+TEST(GaussianEliminationPlan, optimize) {
+  GaussianEliminationPlan plan(Chain(1.0), chainOrdering);
+  EXPECT_LONGS_EQUAL(4, plan.nrFactors());
+  EXPECT(plan.nrClusters() > 0);
+
+  // Re-use the plan for graphs with the same structure
+  for (double scale : {1.0, 2.0, 3.0}) {
+    const GaussianFactorGraph chain = Chain(scale);
+    EXPECT(plan.matches(chain));
+    const VectorValues expected = chain.optimize(chainOrdering);
+    EXPECT(assert_equal(expected, plan.optimize(chain, EliminateQR)));
+    EXPECT(assert_equal(expected, plan.optimize(chain, EliminateCholesky)));
+  }
+
+  // Also works when the factors are of a different type
+  GaussianFactorGraph hessians;
+  for (const auto& factor : Chain(2.0))
+    hessians += HessianFactor(*factor);
+  EXPECT(assert_equal(Chain(2.0).optimize(chainOrdering),
+                      plan.optimize(hessians, EliminateCholesky)));
+}
+
+/* ************************************************************************* */
+TEST(GaussianEliminationPlan, nullFactors) {
+  GaussianFactorGraph structure = Chain(1.0);
+  structure.push_back(GaussianFactor::shared_ptr());
+  GaussianEliminationPlan plan(structure, chainOrdering);
+  EXPECT(plan.matches(structure));
+
+  // Null factors are skipped
+  GaussianFactorGraph chain = Chain(2.0);
+  chain.push_back(GaussianFactor::shared_ptr());
+  EXPECT(assert_equal(Chain(2.0).optimize(chainOrdering), plan.optimize(chain, EliminateQR)));
+
+  // But a factor where the structure had none can not be placed
+  GaussianFactorGraph mismatch = Chain(2.0);
+  mismatch += JacobianFactor(x1, I_1x1, Vector1(1.), chainNoise);
+  EXPECT(!plan.matches(mismatch));
+  CHECK_EXCEPTION(plan.eliminate(mismatch, EliminateQR), std::invalid_argument);
+
+  // Same if the sizes differ
+  EXPECT(!plan.matches(Chain(2.0)));
+  CHECK_EXCEPTION(plan.eliminate(Chain(2.0), EliminateQR), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
+/* ************************************************************************* */
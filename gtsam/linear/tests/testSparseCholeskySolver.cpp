@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testSparseCholeskySolver.cpp
+ * @brief Unit tests for SparseCholeskySolver
+ * @date Oct 2026
+ */
+
+#include <gtsam/linear/SparseCholeskySolver.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/linear/linearExceptions.h>
+#include <gtsam/inference/inferenceExceptions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <boost/assign/list_of.hpp>
+using boost::assign::list_of;
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+  const Key x1 = 1, x2 = 2, x3 = 3;
+  const SharedDiagonal unit2 = noiseModel::Unit::Create(2);
+  const SharedDiagonal sigma2 = noiseModel::Isotropic::Sigma(2, 0.5);
+
+  // A chain x1 - x2 - x3 on 2D variables, anchored at x1
+  GaussianFactorGraph Chain() {
+    GaussianFactorGraph chain;
+    chain += JacobianFactor(x1, 10 * I_2x2, Vector2(-1, -1), unit2);
+    chain += JacobianFactor(x1, -10 * I_2x2, x2, 10 * I_2x2, Vector2(2, -1), unit2);
+    chain += JacobianFactor(x2, (Matrix2() << 1, 2, 3, 4).finished(), x3, -I_2x2,
+                            Vector2(0, 1), sigma2);
+    chain += JacobianFactor(x1, -5 * I_2x2, x3, 5 * I_2x2, Vector2(0, 1), unit2);
+    return chain;
+  }
+}
+
+/* ************************************************************************* */
+TEST(SparseCholeskySolver, optimize) {
+  const GaussianFactorGraph chain = Chain();
+  const VectorValues expected = chain.optimize();
+
+  // The solution should not depend on the ordering
+  for (const Ordering& ordering :
+       {Ordering(list_of(x1)(x2)(x3)), Ordering(list_of(x3)(x1)(x2)), Ordering::Colamd(chain)}) {
+    SparseCholeskySolver solver(ordering);
+    EXPECT(assert_equal(expected, solver.optimize(chain)));
+    // Second solve re-uses the symbolic analysis
+    EXPECT(assert_equal(expected, solver.optimize(chain)));
+  }
+}
+
+/* ************************************************************************* */
+TEST(SparseCholeskySolver, hessianFactors) {
+  // Mix Jacobian and Hessian factors
+  const GaussianFactorGraph chain = Chain();
+  GaussianFactorGraph mixed;
+  mixed += chain[0];
+  mixed += HessianFactor(*chain[1]);
+  mixed += chain[2];
+  mixed += HessianFactor(*chain[3]);
+  mixed += GaussianFactor::shared_ptr();  // null factors are skipped
+
+  SparseCholeskySolver solver(Ordering(list_of(x2)(x3)(x1)));
+  EXPECT(assert_equal(chain.optimize(), solver.optimize(mixed)));
+}
+
+/* ************************************************************************* */
+TEST(SparseCholeskySolver, errors) {
+  // Without the prior on x1, the relative factors leave the system indeterminant
+  GaussianFactorGraph chain = Chain();
+  chain.remove(0);
+  chain.remove(2);
+  SparseCholeskySolver solver(Ordering(list_of(x1)(x2)(x3)));
+  CHECK_EXCEPTION(solver.optimize(chain), IndeterminantLinearSystemException);
+
+  // Constrained noise models can not be handled by Cholesky
+  GaussianFactorGraph constrained = Chain();
+  constrained += JacobianFactor(x2, I_2x2, Vector2(1, 1), noiseModel::Constrained::All(2));
+  CHECK_EXCEPTION(solver.optimize(constrained), std::invalid_argument);
+
+  // The ordering has to contain exactly the variables in the graph
+  SparseCholeskySolver incomplete(Ordering(list_of(x1)(x2)));
+  CHECK_EXCEPTION(incomplete.optimize(Chain()), InconsistentEliminationRequested);
+  SparseCholeskySolver tooLarge(Ordering(list_of(x1)(x2)(x3)(4)));
+  CHECK_EXCEPTION(tooLarge.optimize(Chain()), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
+/* ************************************************************************* */
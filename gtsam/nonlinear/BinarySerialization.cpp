@@ -0,0 +1,687 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file BinarySerialization.cpp
+ * @brief Compact, versioned binary format for factor graphs, Values and VectorValues
+ * @date Oct 2026
+ */
+
+#include <gtsam/nonlinear/BinarySerialization.h>
+#include <gtsam/slam/BetweenFactor.h>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <fstream>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+namespace {
+
+// Every serialized object starts with kMagic, the format version, kByteOrderMark (since version
+// 2) and the kind of object
+const char kMagic[8] = {'G', 'T', 'S', 'A', 'M', 'B', 'I', 'N'};
+const uint32_t kByteOrderMark = 0x01020304;
+
+// Noise models larger than this are rejected as corrupt, as their dimension is not bounded by
+// the size of the input for unit and isotropic models
+const uint64_t kMaxNoiseModelDimension = 1 << 16;
+
+enum ContentKind : uint32_t { kValues = 1, kVectorValues = 2, kNonlinearFactorGraph = 3 };
+
+// Noise model and robust loss function kinds
+enum NoiseModelKind : uint8_t {
+  kGaussian = 1, kDiagonal, kConstrained, kIsotropic, kUnit, kRobust
+};
+enum LossFunctionKind : uint8_t {
+  kNull = 1, kFair, kHuber, kCauchy, kTukey, kWelsch, kGemanMcClure, kDCS, kL2WithDeadZone
+};
+
+// Reference to a noise model or type name: kNone, kNew followed by its definition, or i > 0
+// for the ith one defined so far. Definitions are numbered once they are complete, so that a
+// robust noise model is numbered after the noise model it contains.
+const uint32_t kNone = 0, kNew = 0xFFFFFFFF;
+
+// Type names are written the first time a type is used in an object, and referred to by index
+// afterwards, like shared noise models
+class TypeTable {
+  unordered_map<string, uint32_t> written_;
+  vector<string> read_;
+
+public:
+  void write(const string& name, BinaryWriter& writer) {
+    auto it = written_.find(name);
+    if (it != written_.end()) {
+      writer.write<uint32_t>(it->second);
+    } else {
+      writer.write<uint32_t>(kNew);
+      writer.writeString(name);
+      written_.emplace(name, written_.size() + 1);
+    }
+  }
+
+  // Given the reference that was already read, return the index of the type in the order in
+  // which types were defined. For a new type, also return its name.
+  size_t read(uint32_t reference, BinaryReader& reader, string* newName) {
+    if (reference == kNew) {
+      read_.push_back(reader.readString());
+      *newName = read_.back();
+      return read_.size() - 1;
+    }
+    if (reference == kNone || reference > read_.size())
+      throw runtime_error("deserializeCompact: corrupt type reference");
+    return reference - 1;
+  }
+};
+
+// If loss is a LOSS, return its kind and parameter
+template <class LOSS>
+bool matchLoss(const noiseModel::mEstimator::Base& loss, LossFunctionKind kind, uint8_t* k,
+               double* parameter) {
+  const LOSS* typed = dynamic_cast<const LOSS*>(&loss);
+  if (typed) {
+    *k = kind;
+    *parameter = typed->modelParameter();
+  }
+  return typed != nullptr;
+}
+
+uint32_t byteSwap(uint32_t x) {
+  return (x >> 24) | ((x >> 8) & 0xFF00) | ((x << 8) & 0xFF0000) | (x << 24);
+}
+
+void writeHeader(ContentKind kind, BinaryWriter& writer) {
+  for (char c : kMagic)
+    writer.write(c);
+  writer.write<uint32_t>(kCompactBinaryVersion);
+  writer.write<uint32_t>(kByteOrderMark);
+  writer.write<uint32_t>(kind);
+}
+
+void readHeader(ContentKind kind, BinaryReader& reader) {
+  for (char c : kMagic)
+    if (reader.read<char>() != c)
+      throw runtime_error("deserializeCompact: not a compact binary GTSAM archive");
+  const uint32_t version = reader.read<uint32_t>();
+  if (version == 0 || version > kCompactBinaryVersion) {
+    const uint32_t swapped = byteSwap(version);
+    if (swapped != 0 && swapped <= kCompactBinaryVersion)
+      throw runtime_error("deserializeCompact: archive was written with a different byte order");
+    throw runtime_error("deserializeCompact: unsupported format version "
+        + to_string(version));
+  }
+  if (version >= 2 && reader.read<uint32_t>() != kByteOrderMark)
+    throw runtime_error("deserializeCompact: archive was written with a different byte order");
+  if (reader.read<uint32_t>() != kind)
+    throw runtime_error("deserializeCompact: archive holds a different type of object");
+}
+
+// Read the number of entries of an object, each of which takes at least minBytes
+uint64_t readCount(BinaryReader& reader, size_t minBytes) {
+  const uint64_t n = reader.read<uint64_t>();
+  if (n > reader.remaining() / minBytes)
+    throw runtime_error("deserializeCompact: unexpected end of data");
+  return n;
+}
+
+/* ************************************************************************* */
+void write(const Values& values, BinaryWriter& writer) {
+  const BinaryRegistry& registry = BinaryRegistry::Instance();
+  TypeTable types;
+  writeHeader(kValues, writer);
+  writer.write<uint64_t>(values.size());
+  for (const auto& key_value : values) {
+    const BinaryRegistry::ValueType& type = registry.valueType(typeid(key_value.value));
+    writer.write<uint64_t>(key_value.key);
+    types.write(type.name, writer);
+    type.write(key_value.value, writer);
+  }
+}
+
+void read(BinaryReader& reader, Values& values) {
+  const BinaryRegistry& registry = BinaryRegistry::Instance();
+  TypeTable types;
+  vector<const BinaryRegistry::ValueType*> typesRead;
+  readHeader(kValues, reader);
+  values.clear();
+  const uint64_t n = readCount(reader, sizeof(uint64_t) + sizeof(uint32_t));
+  for (uint64_t i = 0; i < n; ++i) {
+    const Key key = reader.read<uint64_t>();
+    if (values.exists(key))
+      throw runtime_error("deserializeCompact: duplicate key " + to_string(key));
+    string name;
+    const size_t index = types.read(reader.read<uint32_t>(), reader, &name);
+    if (index == typesRead.size())
+      typesRead.push_back(&registry.valueType(name));
+    typesRead[index]->read(key, reader, values);
+  }
+}
+
+/* ************************************************************************* */
+void write(const VectorValues& values, BinaryWriter& writer) {
+  writeHeader(kVectorValues, writer);
+  writer.write<uint64_t>(values.size());
+  for (const auto& key_value : values) {
+    writer.write<uint64_t>(key_value.first);
+    writer.writeVector(key_value.second);
+  }
+}
+
+void read(BinaryReader& reader, VectorValues& values) {
+  readHeader(kVectorValues, reader);
+  values = VectorValues();
+  const uint64_t n = readCount(reader, 2 * sizeof(uint64_t));
+  for (uint64_t i = 0; i < n; ++i) {
+    const Key key = reader.read<uint64_t>();
+    if (values.exists(key))
+      throw runtime_error("deserializeCompact: duplicate key " + to_string(key));
+    values.insert(key, Vector(reader.readVector()));
+  }
+}
+
+/* ************************************************************************* */
+void write(const NonlinearFactorGraph& graph, BinaryWriter& writer) {
+  const BinaryRegistry& registry = BinaryRegistry::Instance();
+  TypeTable types;
+  writeHeader(kNonlinearFactorGraph, writer);
+  writer.write<uint64_t>(graph.size());
+  for (const auto& factor : graph) {
+    if (!factor) {
+      writer.write<uint32_t>(kNone);
+      continue;
+    }
+    const BinaryRegistry::FactorType& type = registry.factorType(typeid(*factor));
+    types.write(type.name, writer);
+    type.write(*factor, writer);
+  }
+}
+
+void read(BinaryReader& reader, NonlinearFactorGraph& graph) {
+  const BinaryRegistry& registry = BinaryRegistry::Instance();
+  TypeTable types;
+  vector<const BinaryRegistry::FactorType*> typesRead;
+  readHeader(kNonlinearFactorGraph, reader);
+  const uint64_t n = readCount(reader, sizeof(uint32_t));
+  graph.resize(0);
+  graph.reserve(n);
+  for (uint64_t i = 0; i < n; ++i) {
+    const uint32_t reference = reader.read<uint32_t>();
+    if (reference == kNone) {
+      graph.push_back(NonlinearFactor::shared_ptr());
+      continue;
+    }
+    string name;
+    const size_t index = types.read(reference, reader, &name);
+    if (index == typesRead.size())
+      typesRead.push_back(&registry.factorType(name));
+    graph.push_back(typesRead[index]->read(reader));
+  }
+}
+
+/* ************************************************************************* */
+template <class T>
+string serializeCompactImpl(const T& input) {
+  BinaryWriter writer;
+  write(input, writer);
+  return writer.buffer();
+}
+
+template <class T>
+void deserializeCompactImpl(const char* data, size_t size, T& output) {
+  BinaryReader reader(data, size);
+  read(reader, output);
+  if (!reader.atEnd())
+    throw runtime_error("deserializeCompact: unexpected data after the end of the archive");
+}
+
+template <class T>
+bool serializeToCompactFileImpl(const T& input, const string& filename) {
+  ofstream stream(filename.c_str(), ios::out | ios::binary);
+  if (!stream.is_open())
+    return false;
+  const string buffer = serializeCompactImpl(input);
+  stream.write(buffer.data(), buffer.size());
+  return bool(stream);
+}
+
+template <class T>
+bool deserializeFromCompactFileImpl(const string& filename, T& output) {
+  namespace ip = boost::interprocess;
+  boost::system::error_code error;
+  if (!boost::filesystem::is_regular_file(filename, error))
+    return false;
+  if (boost::filesystem::file_size(filename, error) == 0)
+    throw runtime_error("deserializeFromCompactFile: " + filename + " is empty");
+  // Matrices are read directly from the mapped file
+  ip::file_mapping file(filename.c_str(), ip::read_only);
+  ip::mapped_region region(file, ip::read_only);
+  deserializeCompactImpl(static_cast<const char*>(region.get_address()), region.get_size(),
+                         output);
+  return true;
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+void BinaryWriter::writeString(const string& s) {
+  write<uint64_t>(s.size());
+  buffer_.append(s);
+}
+
+/* ************************************************************************* */
+void BinaryWriter::align() {
+  buffer_.append((8 - buffer_.size() % 8) % 8, '\0');
+}
+
+/* ************************************************************************* */
+void BinaryWriter::writeVector(const Vector& v) {
+  write<uint64_t>(v.size());
+  align();
+  buffer_.append(reinterpret_cast<const char*>(v.data()), sizeof(double) * v.size());
+}
+
+/* ************************************************************************* */
+void BinaryWriter::writeMatrix(const Matrix& A) {
+  write<uint64_t>(A.rows());
+  write<uint64_t>(A.cols());
+  align();
+  buffer_.append(reinterpret_cast<const char*>(A.data()), sizeof(double) * A.size());
+}
+
+/* ************************************************************************* */
+void BinaryWriter::writeNoiseModel(const SharedNoiseModel& model) {
+  if (!model) {
+    write<uint32_t>(kNone);
+    return;
+  }
+  auto it = noiseModels_.find(model.get());
+  if (it != noiseModels_.end()) {
+    write<uint32_t>(it->second);
+    return;
+  }
+  write<uint32_t>(kNew);
+
+  // Write the most derived type first, since they derive from each other
+  if (auto unit = boost::dynamic_pointer_cast<noiseModel::Unit>(model)) {
+    write<uint8_t>(kUnit);
+    write<uint64_t>(unit->dim());
+  } else if (auto isotropic = boost::dynamic_pointer_cast<noiseModel::Isotropic>(model)) {
+    write<uint8_t>(kIsotropic);
+    write<uint64_t>(isotropic->dim());
+    write<double>(isotropic->sigma());
+  } else if (auto constrained = boost::dynamic_pointer_cast<noiseModel::Constrained>(model)) {
+    write<uint8_t>(kConstrained);
+    writeVector(constrained->mu());
+    writeVector(constrained->sigmas());
+  } else if (auto diagonal = boost::dynamic_pointer_cast<noiseModel::Diagonal>(model)) {
+    write<uint8_t>(kDiagonal);
+    writeVector(diagonal->sigmas());
+  } else if (auto gaussian = boost::dynamic_pointer_cast<noiseModel::Gaussian>(model)) {
+    write<uint8_t>(kGaussian);
+    writeMatrix(gaussian->R());
+  } else if (auto robust = boost::dynamic_pointer_cast<noiseModel::Robust>(model)) {
+    namespace m = noiseModel::mEstimator;
+    const m::Base& loss = *robust->robust();
+    uint8_t kind = 0;
+    double parameter = 0.0;
+    if (dynamic_cast<const m::Null*>(&loss))
+      kind = kNull;
+    else if (!(matchLoss<m::Fair>(loss, kFair, &kind, &parameter)
+        || matchLoss<m::Huber>(loss, kHuber, &kind, &parameter)
+        || matchLoss<m::Cauchy>(loss, kCauchy, &kind, &parameter)
+        || matchLoss<m::Tukey>(loss, kTukey, &kind, &parameter)
+        || matchLoss<m::Welsch>(loss, kWelsch, &kind, &parameter)
+        || matchLoss<m::GemanMcClure>(loss, kGemanMcClure, &kind, &parameter)
+        || matchLoss<m::DCS>(loss, kDCS, &kind, &parameter)
+        || matchLoss<m::L2WithDeadZone>(loss, kL2WithDeadZone, &kind, &parameter)))
+      throw invalid_argument("serializeCompact: unsupported robust loss function");
+    write<uint8_t>(kRobust);
+    write<uint8_t>(kind);
+    write<uint8_t>(loss.reweightScheme());
+    write<double>(parameter);
+    writeNoiseModel(robust->noise());
+  } else {
+    throw invalid_argument("serializeCompact: unsupported noise model");
+  }
+  noiseModels_.emplace(model.get(), noiseModels_.size() + 1);
+}
+
+/* ************************************************************************* */
+string BinaryReader::readString() {
+  const uint64_t n = read<uint64_t>();
+  return string(consume(n), n);
+}
+
+/* ************************************************************************* */
+void BinaryReader::align() {
+  consume((8 - pos_ % 8) % 8);
+}
+
+/* ************************************************************************* */
+Eigen::Map<const Vector> BinaryReader::readVector() {
+  const uint64_t n = read<uint64_t>();
+  align();
+  if (n > (size_ - pos_) / sizeof(double))
+    throw runtime_error("BinaryReader: unexpected end of data");
+  return Eigen::Map<const Vector>(reinterpret_cast<const double*>(consume(sizeof(double) * n)),
+                                  n);
+}
+
+/* ************************************************************************* */
+Eigen::Map<const Matrix> BinaryReader::readMatrix() {
+  const uint64_t m = read<uint64_t>(), n = read<uint64_t>();
+  align();
+  if (n != 0 && m > (size_ - pos_) / sizeof(double) / n)
+    throw runtime_error("BinaryReader: unexpected end of data");
+  return Eigen::Map<const Matrix>(
+      reinterpret_cast<const double*>(consume(sizeof(double) * m * n)), m, n);
+}
+
+/* ************************************************************************* */
+SharedNoiseModel BinaryReader::readNoiseModel() {
+  const uint32_t reference = read<uint32_t>();
+  if (reference == kNone)
+    return SharedNoiseModel();
+  if (reference != kNew) {
+    if (reference > noiseModels_.size())
+      throw runtime_error("BinaryReader: corrupt noise model reference");
+    return noiseModels_[reference - 1];
+  }
+
+  // Checks the dimension of a noise model
+  const auto checkDimension = [](uint64_t dim) {
+    if (dim == 0 || dim > kMaxNoiseModelDimension)
+      throw runtime_error("BinaryReader: invalid noise model dimension " + to_string(dim));
+    return dim;
+  };
+
+  SharedNoiseModel model;
+  switch (read<uint8_t>()) {
+  case kUnit:
+    model = noiseModel::Unit::Create(checkDimension(read<uint64_t>()));
+    break;
+  case kIsotropic: {
+    const uint64_t dim = checkDimension(read<uint64_t>());
+    model = noiseModel::Isotropic::Sigma(dim, read<double>(), false);
+    break;
+  }
+  case kConstrained: {
+    const Eigen::Map<const Vector> mu = readVector(), sigmas = readVector();
+    checkDimension(sigmas.size());
+    if (mu.size() != sigmas.size())
+      throw runtime_error("BinaryReader: constrained noise model with " + to_string(mu.size())
+          + " weights for " + to_string(sigmas.size()) + " sigmas");
+    model = noiseModel::Constrained::MixedSigmas(mu, sigmas);
+    break;
+  }
+  case kDiagonal: {
+    const Eigen::Map<const Vector> sigmas = readVector();
+    checkDimension(sigmas.size());
+    model = noiseModel::Diagonal::Sigmas(sigmas, false);
+    break;
+  }
+  case kGaussian: {
+    const Eigen::Map<const Matrix> R = readMatrix();
+    checkDimension(R.cols());
+    if (R.rows() != R.cols())
+      throw runtime_error("BinaryReader: Gaussian noise model with a non-square R");
+    model = noiseModel::Gaussian::SqrtInformation(R, false);
+    break;
+  }
+  case kRobust: {
+    namespace m = noiseModel::mEstimator;
+    const uint8_t kind = read<uint8_t>();
+    const uint8_t scheme = read<uint8_t>();
+    if (scheme != m::Base::Scalar && scheme != m::Base::Block)
+      throw runtime_error("BinaryReader: unknown reweight scheme " + to_string(scheme));
+    const m::Base::ReweightScheme reweight = m::Base::ReweightScheme(scheme);
+    const double c = read<double>();
+    m::Base::shared_ptr loss;
+    switch (kind) {
+    case kNull: loss = boost::make_shared<m::Null>(reweight); break;
+    case kFair: loss = m::Fair::Create(c, reweight); break;
+    case kHuber: loss = m::Huber::Create(c, reweight); break;
+    case kCauchy: loss = m::Cauchy::Create(c, reweight); break;
+    case kTukey: loss = m::Tukey::Create(c, reweight); break;
+    case kWelsch: loss = m::Welsch::Create(c, reweight); break;
+    case kGemanMcClure: loss = m::GemanMcClure::Create(c, reweight); break;
+    case kDCS: loss = m::DCS::Create(c, reweight); break;
+    case kL2WithDeadZone: loss = m::L2WithDeadZone::Create(c, reweight); break;
+    default: throw runtime_error("BinaryReader: unknown robust loss function");
+    }
+    model = noiseModel::Robust::Create(loss, readNoiseModel());
+    break;
+  }
+  default:
+    throw runtime_error("BinaryReader: unknown noise model");
+  }
+  noiseModels_.push_back(model);
+  return model;
+}
+
+/* ************************************************************************* */
+void BinaryCodec<double>::Write(const double& x, BinaryWriter& writer) {
+  writer.write(x);
+}
+double BinaryCodec<double>::Read(BinaryReader& reader) {
+  return reader.read<double>();
+}
+
+void BinaryCodec<Vector>::Write(const Vector& v, BinaryWriter& writer) {
+  writer.writeVector(v);
+}
+Vector BinaryCodec<Vector>::Read(BinaryReader& reader) {
+  return reader.readVector();
+}
+
+void BinaryCodec<Point2>::Write(const Point2& p, BinaryWriter& writer) {
+  writer.writeFixed<2, 1>(p);
+}
+Point2 BinaryCodec<Point2>::Read(BinaryReader& reader) {
+  return reader.readFixed<2, 1>();
+}
+
+void BinaryCodec<Point3>::Write(const Point3& p, BinaryWriter& writer) {
+  writer.writeFixed<3, 1>(p);
+}
+Point3 BinaryCodec<Point3>::Read(BinaryReader& reader) {
+  return Point3(Vector3(reader.readFixed<3, 1>()));
+}
+
+void BinaryCodec<Rot2>::Write(const Rot2& R, BinaryWriter& writer) {
+  writer.write(R.c());
+  writer.write(R.s());
+}
+Rot2 BinaryCodec<Rot2>::Read(BinaryReader& reader) {
+  const double c = reader.read<double>();
+  return Rot2::fromCosSin(c, reader.read<double>());
+}
+
+void BinaryCodec<Rot3>::Write(const Rot3& R, BinaryWriter& writer) {
+  writer.writeFixed<3, 3>(R.matrix());
+}
+Rot3 BinaryCodec<Rot3>::Read(BinaryReader& reader) {
+  return Rot3(Matrix3(reader.readFixed<3, 3>()));
+}
+
+void BinaryCodec<Pose2>::Write(const Pose2& pose, BinaryWriter& writer) {
+  BinaryCodec<Rot2>::Write(pose.rotation(), writer);
+  BinaryCodec<Point2>::Write(pose.translation(), writer);
+}
+Pose2 BinaryCodec<Pose2>::Read(BinaryReader& reader) {
+  const Rot2 R = BinaryCodec<Rot2>::Read(reader);
+  return Pose2(R, BinaryCodec<Point2>::Read(reader));
+}
+
+void BinaryCodec<Pose3>::Write(const Pose3& pose, BinaryWriter& writer) {
+  BinaryCodec<Rot3>::Write(pose.rotation(), writer);
+  BinaryCodec<Point3>::Write(pose.translation(), writer);
+}
+Pose3 BinaryCodec<Pose3>::Read(BinaryReader& reader) {
+  const Rot3 R = BinaryCodec<Rot3>::Read(reader);
+  return Pose3(R, BinaryCodec<Point3>::Read(reader));
+}
+
+/* ************************************************************************* */
+// Encoding of a BetweenFactor: keys, measurement and noise model
+template <class VALUE>
+struct BinaryCodec<BetweenFactor<VALUE> > {
+  static void Write(const BetweenFactor<VALUE>& factor, BinaryWriter& writer) {
+    writer.write<uint64_t>(factor.key1());
+    writer.write<uint64_t>(factor.key2());
+    BinaryCodec<VALUE>::Write(factor.measured(), writer);
+    writer.writeNoiseModel(factor.noiseModel());
+  }
+  static BetweenFactor<VALUE> Read(BinaryReader& reader) {
+    const Key key1 = reader.read<uint64_t>();
+    const Key key2 = reader.read<uint64_t>();
+    const VALUE measured = BinaryCodec<VALUE>::Read(reader);
+    return BetweenFactor<VALUE>(key1, key2, measured, reader.readNoiseModel());
+  }
+};
+
+/* ************************************************************************* */
+BinaryRegistry& BinaryRegistry::Instance() {
+  static BinaryRegistry registry;
+  return registry;
+}
+
+/* ************************************************************************* */
+BinaryRegistry::BinaryRegistry() {
+  registerValue<double>("double");
+  registerValue<Vector>("Vector");
+  registerValue<Point2>("Point2");
+  registerValue<Point3>("Point3");
+  registerValue<Rot2>("Rot2");
+  registerValue<Rot3>("Rot3");
+  registerValue<Pose2>("Pose2");
+  registerValue<Pose3>("Pose3");
+
+  registerFactor<PriorFactor<Vector> >("PriorFactor<Vector>");
+  registerFactor<PriorFactor<Point2> >("PriorFactor<Point2>");
+  registerFactor<PriorFactor<Point3> >("PriorFactor<Point3>");
+  registerFactor<PriorFactor<Rot2> >("PriorFactor<Rot2>");
+  registerFactor<PriorFactor<Rot3> >("PriorFactor<Rot3>");
+  registerFactor<PriorFactor<Pose2> >("PriorFactor<Pose2>");
+  registerFactor<PriorFactor<Pose3> >("PriorFactor<Pose3>");
+
+  registerFactor<BetweenFactor<Point2> >("BetweenFactor<Point2>");
+  registerFactor<BetweenFactor<Point3> >("BetweenFactor<Point3>");
+  registerFactor<BetweenFactor<Rot2> >("BetweenFactor<Rot2>");
+  registerFactor<BetweenFactor<Rot3> >("BetweenFactor<Rot3>");
+  registerFactor<BetweenFactor<Pose2> >("BetweenFactor<Pose2>");
+  registerFactor<BetweenFactor<Pose3> >("BetweenFactor<Pose3>");
+}
+
+/* ************************************************************************* */
+void BinaryRegistry::addValueType(const type_info& type, const ValueType& valueType) {
+  if (valueTypesByName_.count(valueType.name))
+    throw invalid_argument("BinaryRegistry: value type " + valueType.name
+        + " is already registered");
+  const ValueType& added = valueTypes_[type_index(type)] = valueType;
+  valueTypesByName_[valueType.name] = &added;
+}
+
+/* ************************************************************************* */
+void BinaryRegistry::addFactorType(const type_info& type, const FactorType& factorType) {
+  if (factorTypesByName_.count(factorType.name))
+    throw invalid_argument("BinaryRegistry: factor type " + factorType.name
+        + " is already registered");
+  const FactorType& added = factorTypes_[type_index(type)] = factorType;
+  factorTypesByName_[factorType.name] = &added;
+}
+
+/* ************************************************************************* */
+const BinaryRegistry::ValueType& BinaryRegistry::valueType(const type_info& type) const {
+  auto it = valueTypes_.find(type_index(type));
+  if (it == valueTypes_.end())
+    throw invalid_argument(string("serializeCompact: value type ") + type.name()
+        + " is not registered with BinaryRegistry");
+  return it->second;
+}
+
+/* ************************************************************************* */
+const BinaryRegistry::ValueType& BinaryRegistry::valueType(const string& name) const {
+  auto it = valueTypesByName_.find(name);
+  if (it == valueTypesByName_.end())
+    throw runtime_error("deserializeCompact: value type " + name
+        + " is not registered with BinaryRegistry");
+  return *it->second;
+}
+
+/* ************************************************************************* */
+const BinaryRegistry::FactorType& BinaryRegistry::factorType(const type_info& type) const {
+  auto it = factorTypes_.find(type_index(type));
+  if (it == factorTypes_.end())
+    throw invalid_argument(string("serializeCompact: factor type ") + type.name()
+        + " is not registered with BinaryRegistry");
+  return it->second;
+}
+
+/* ************************************************************************* */
+const BinaryRegistry::FactorType& BinaryRegistry::factorType(const string& name) const {
+  auto it = factorTypesByName_.find(name);
+  if (it == factorTypesByName_.end())
+    throw runtime_error("deserializeCompact: factor type " + name
+        + " is not registered with BinaryRegistry");
+  return *it->second;
+}
+
+/* ************************************************************************* */
+string serializeCompact(const Values& input) {
+  return serializeCompactImpl(input);
+}
+string serializeCompact(const VectorValues& input) {
+  return serializeCompactImpl(input);
+}
+string serializeCompact(const NonlinearFactorGraph& input) {
+  return serializeCompactImpl(input);
+}
+
+/* ************************************************************************* */
+void deserializeCompact(const string& serialized, Values& output) {
+  deserializeCompactImpl(serialized.data(), serialized.size(), output);
+}
+void deserializeCompact(const string& serialized, VectorValues& output) {
+  deserializeCompactImpl(serialized.data(), serialized.size(), output);
+}
+void deserializeCompact(const string& serialized, NonlinearFactorGraph& output) {
+  deserializeCompactImpl(serialized.data(), serialized.size(), output);
+}
+
+/* ************************************************************************* */
+bool serializeToCompactFile(const Values& input, const string& filename) {
+  return serializeToCompactFileImpl(input, filename);
+}
+bool serializeToCompactFile(const VectorValues& input, const string& filename) {
+  return serializeToCompactFileImpl(input, filename);
+}
+bool serializeToCompactFile(const NonlinearFactorGraph& input, const string& filename) {
+  return serializeToCompactFileImpl(input, filename);
+}
+
+/* ************************************************************************* */
+bool deserializeFromCompactFile(const string& filename, Values& output) {
+  return deserializeFromCompactFileImpl(filename, output);
+}
+bool deserializeFromCompactFile(const string& filename, VectorValues& output) {
+  return deserializeFromCompactFileImpl(filename, output);
+}
+bool deserializeFromCompactFile(const string& filename, NonlinearFactorGraph& output) {
+  return deserializeFromCompactFileImpl(filename, output);
+}
+
+} // \namespace gtsam
@@ -0,0 +1,309 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file BinarySerialization.h
+ * @brief Compact, versioned binary format for factor graphs, Values and VectorValues
+ * @date Oct 2026
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/nonlinear/PriorFactor.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Pose3.h>
+
+#include <boost/make_shared.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace gtsam {
+
+  /**
+   * Appends plain data to a byte buffer in the compact binary format. Numbers are written in
+   * the native byte order, which is recorded in the header of an archive, and matrix and vector
+   * payloads are 8-byte aligned so that BinaryReader can map them in place. Noise models are
+   * written once, later occurrences of the same shared noise model are written as a reference
+   * to the first one.
+   */
+  class GTSAM_EXPORT BinaryWriter {
+  public:
+    /// Write a number or other trivially copyable object
+    template <typename T>
+    void write(const T& x) {
+      static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter: not a plain type");
+      buffer_.append(reinterpret_cast<const char*>(&x), sizeof(T));
+    }
+
+    /// Write a string, preceded by its length
+    void writeString(const std::string& s);
+
+    /// Write the coefficients of a fixed-size matrix or vector, in column-major order
+    template <int M, int N>
+    void writeFixed(const Eigen::Matrix<double, M, N>& A) {
+      align();
+      buffer_.append(reinterpret_cast<const char*>(A.data()), sizeof(double) * M * N);
+    }
+
+    /// Write a dynamic vector, preceded by its size
+    void writeVector(const Vector& v);
+
+    /// Write a dynamic matrix, preceded by its size
+    void writeMatrix(const Matrix& A);
+
+    /// Write a noise model, which may be null
+    void writeNoiseModel(const SharedNoiseModel& model);
+
+    /// The bytes written so far
+    const std::string& buffer() const { return buffer_; }
+
+  private:
+    std::string buffer_;
+    std::unordered_map<const noiseModel::Base*, uint32_t> noiseModels_; ///< Models written so far
+
+    /// Pad the buffer to a multiple of 8 bytes
+    void align();
+  };
+
+  /**
+   * Reads the compact binary format from a buffer, which must outlive the reader. Matrices and
+   * vectors are returned as Eigen maps into the buffer, so that they are copied at most once,
+   * into the object that is being read.
+   */
+  class GTSAM_EXPORT BinaryReader {
+  public:
+    /// Read from size bytes at data
+    BinaryReader(const char* data, size_t size) : data_(data), size_(size), pos_(0) {}
+
+    /// Read a number or other trivially copyable object
+    template <typename T>
+    T read() {
+      static_assert(std::is_trivially_copyable<T>::value, "BinaryReader: not a plain type");
+      T x;
+      std::memcpy(&x, consume(sizeof(T)), sizeof(T));
+      return x;
+    }
+
+    /// Read a string written by BinaryWriter::writeString
+    std::string readString();
+
+    /// Read a fixed-size matrix or vector written by BinaryWriter::writeFixed
+    template <int M, int N>
+    Eigen::Map<const Eigen::Matrix<double, M, N> > readFixed() {
+      align();
+      return Eigen::Map<const Eigen::Matrix<double, M, N> >(
+          reinterpret_cast<const double*>(consume(sizeof(double) * M * N)));
+    }
+
+    /// Read a dynamic vector written by BinaryWriter::writeVector
+    Eigen::Map<const Vector> readVector();
+
+    /// Read a dynamic matrix written by BinaryWriter::writeMatrix
+    Eigen::Map<const Matrix> readMatrix();
+
+    /// Read a noise model written by BinaryWriter::writeNoiseModel
+    SharedNoiseModel readNoiseModel();
+
+    /// True if all bytes were read
+    bool atEnd() const { return pos_ == size_; }
+
+    /// Number of bytes left to read
+    size_t remaining() const { return size_ - pos_; }
+
+  private:
+    const char* data_;
+    size_t size_, pos_;
+    std::vector<SharedNoiseModel> noiseModels_; ///< Models read so far
+
+    /// Skip the padding written by BinaryWriter::align
+    void align();
+
+    /// Return a pointer to the next n bytes and skip them, throws if there are not enough
+    const char* consume(size_t n) {
+      if (n > size_ - pos_)
+        throw std::runtime_error("BinaryReader: unexpected end of data");
+      const char* p = data_ + pos_;
+      pos_ += n;
+      return p;
+    }
+  };
+
+  /**
+   * The compact binary encoding of a value or factor type. Specialize this template with
+   * static Write and Read functions for a type, and register the type with BinaryRegistry, to
+   * be able to save it. Specializations are provided for Vector, the points, rotations and
+   * poses, and for PriorFactor on these types. The registry also saves BetweenFactor on these
+   * types, with a codec in BinarySerialization.cpp so that this header does not depend on
+   * gtsam/slam.
+   */
+  template <typename T>
+  struct BinaryCodec;
+
+#define GTSAM_DECLARE_BINARY_CODEC(TYPE)                  \
+  template <>                                             \
+  struct GTSAM_EXPORT BinaryCodec<TYPE> {                 \
+    static void Write(const TYPE& x, BinaryWriter& writer); \
+    static TYPE Read(BinaryReader& reader);               \
+  };
+
+  GTSAM_DECLARE_BINARY_CODEC(double)
+  GTSAM_DECLARE_BINARY_CODEC(Vector)
+  GTSAM_DECLARE_BINARY_CODEC(Point2)
+  GTSAM_DECLARE_BINARY_CODEC(Point3)
+  GTSAM_DECLARE_BINARY_CODEC(Rot2)
+  GTSAM_DECLARE_BINARY_CODEC(Rot3)
+  GTSAM_DECLARE_BINARY_CODEC(Pose2)
+  GTSAM_DECLARE_BINARY_CODEC(Pose3)
+
+#undef GTSAM_DECLARE_BINARY_CODEC
+
+  /// Encoding of a PriorFactor: key, prior and noise model
+  template <class VALUE>
+  struct BinaryCodec<PriorFactor<VALUE> > {
+    static void Write(const PriorFactor<VALUE>& factor, BinaryWriter& writer) {
+      writer.write<uint64_t>(factor.key());
+      BinaryCodec<VALUE>::Write(factor.prior(), writer);
+      writer.writeNoiseModel(factor.noiseModel());
+    }
+    static PriorFactor<VALUE> Read(BinaryReader& reader) {
+      const Key key = reader.read<uint64_t>();
+      const VALUE prior = BinaryCodec<VALUE>::Read(reader);
+      return PriorFactor<VALUE>(key, prior, reader.readNoiseModel());
+    }
+  };
+
+  /**
+   * The value and factor types that can be saved in the compact binary format, by name. Types
+   * are stored by name in the file, so that files do not depend on the order of registration.
+   * The types with a BinaryCodec in this header are registered on first use, other types
+   * are registered with, e.g.,
+   * \code
+   * BinaryRegistry::Instance().registerFactor<MyFactor>("MyFactor");
+   * \endcode
+   * Registration is not thread-safe, register types before saving or loading in parallel.
+   */
+  class GTSAM_EXPORT BinaryRegistry {
+  public:
+    /// Functions to write and read a value of a registered type
+    struct ValueType {
+      std::string name;
+      std::function<void(const Value&, BinaryWriter&)> write;
+      std::function<void(Key, BinaryReader&, Values&)> read;
+    };
+
+    /// Functions to write and read a factor of a registered type
+    struct FactorType {
+      std::string name;
+      std::function<void(const NonlinearFactor&, BinaryWriter&)> write;
+      std::function<NonlinearFactor::shared_ptr(BinaryReader&)> read;
+    };
+
+    /// The registry
+    static BinaryRegistry& Instance();
+
+    /// Register the value type T, saved with BinaryCodec<T>
+    template <class T>
+    void registerValue(const std::string& name) {
+      ValueType type;
+      type.name = name;
+      type.write = [](const Value& value, BinaryWriter& writer) {
+        BinaryCodec<T>::Write(static_cast<const GenericValue<T>&>(value).value(), writer);
+      };
+      type.read = [](Key j, BinaryReader& reader, Values& values) {
+        values.insert(j, BinaryCodec<T>::Read(reader));
+      };
+      addValueType(typeid(GenericValue<T>), type);
+    }
+
+    /// Register the factor type FACTOR, saved with BinaryCodec<FACTOR>
+    template <class FACTOR>
+    void registerFactor(const std::string& name) {
+      FactorType type;
+      type.name = name;
+      type.write = [](const NonlinearFactor& factor, BinaryWriter& writer) {
+        BinaryCodec<FACTOR>::Write(static_cast<const FACTOR&>(factor), writer);
+      };
+      type.read = [](BinaryReader& reader) -> NonlinearFactor::shared_ptr {
+        return boost::make_shared<FACTOR>(BinaryCodec<FACTOR>::Read(reader));
+      };
+      addFactorType(typeid(FACTOR), type);
+    }
+
+    /// Find a value type by its C++ type (of the GenericValue) or by name, throws if unknown
+    const ValueType& valueType(const std::type_info& type) const;
+    const ValueType& valueType(const std::string& name) const;
+
+    /// Find a factor type by its C++ type or by name, throws if unknown
+    const FactorType& factorType(const std::type_info& type) const;
+    const FactorType& factorType(const std::string& name) const;
+
+  private:
+    std::unordered_map<std::type_index, ValueType> valueTypes_;
+    std::unordered_map<std::string, const ValueType*> valueTypesByName_;
+    std::unordered_map<std::type_index, FactorType> factorTypes_;
+    std::unordered_map<std::string, const FactorType*> factorTypesByName_;
+
+    BinaryRegistry(); ///< Registers the built-in types
+    void addValueType(const std::type_info& type, const ValueType& valueType);
+    void addFactorType(const std::type_info& type, const FactorType& factorType);
+  };
+
+  /**
+   * @name Compact binary serialization
+   * The compact format starts with a magic string, a version number and a byte-order mark, and
+   * is otherwise a flat sequence of numbers, type names and aligned matrix payloads, in the
+   * native byte order of the machine that wrote it. Archives can only be read on a machine with
+   * the same byte order. It is much smaller and
+   * faster to write and read than the boost.serialization archives in serialization.h, and does
+   * not need BOOST_CLASS_EXPORT, but only covers the types in BinaryRegistry. Loading from a file
+   * memory-maps it, so that matrices are copied directly from the file into the result.
+   * Deserialization checks every size and tag against the remaining input, and throws
+   * std::runtime_error on a corrupt or incompatible input, e.g., with a duplicate key.
+   */
+  /// @{
+
+  /// Version of the compact binary format that is written, inputs with a newer version are rejected
+  /// Version 2 added the byte-order mark.
+  static const uint32_t kCompactBinaryVersion = 2;
+
+  GTSAM_EXPORT std::string serializeCompact(const Values& input);
+  GTSAM_EXPORT std::string serializeCompact(const VectorValues& input);
+  GTSAM_EXPORT std::string serializeCompact(const NonlinearFactorGraph& input);
+
+  GTSAM_EXPORT void deserializeCompact(const std::string& serialized, Values& output);
+  GTSAM_EXPORT void deserializeCompact(const std::string& serialized, VectorValues& output);
+  GTSAM_EXPORT void deserializeCompact(const std::string& serialized, NonlinearFactorGraph& output);
+
+  GTSAM_EXPORT bool serializeToCompactFile(const Values& input, const std::string& filename);
+  GTSAM_EXPORT bool serializeToCompactFile(const VectorValues& input, const std::string& filename);
+  GTSAM_EXPORT bool serializeToCompactFile(const NonlinearFactorGraph& input,
+                                           const std::string& filename);
+
+  GTSAM_EXPORT bool deserializeFromCompactFile(const std::string& filename, Values& output);
+  GTSAM_EXPORT bool deserializeFromCompactFile(const std::string& filename, VectorValues& output);
+  GTSAM_EXPORT bool deserializeFromCompactFile(const std::string& filename,
+                                               NonlinearFactorGraph& output);
+
+  /// @}
+
+} // \namespace gtsam
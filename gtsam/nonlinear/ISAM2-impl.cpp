@@ -22,6 +22,11 @@
 #include <gtsam/inference/Symbol.h>  // for selective linearization thresholds
 #include <gtsam/nonlinear/ISAM2-impl.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <boost/range/adaptors.hpp>
 #include <functional>
 #include <limits>
@@ -156,4 +161,35 @@ VectorValues DeltaImpl::ComputeGradientSearch(const VectorValues& gradAtZero,
   return step * gradAtZero;
 }
 
+/* ************************************************************************* */
+void UpdateImpl::linearizeNewFactors(const NonlinearFactorGraph& newFactors,
+                                     const Values& theta,
+                                     size_t numNonlinearFactors,
+                                     const FactorIndices& newFactorsIndices,
+                                     GaussianFactorGraph* linearFactors) const {
+  gttic(linearizeNewFactors);
+  // Without findUnusedFactorSlots the new indices simply follow the old ones.
+  // Null new factors leave their slot empty, and may share it with a later one.
+  assert(newFactorsIndices.size() == newFactors.size());
+  linearFactors->resize(numNonlinearFactors);
+  auto linearizeRange = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+      if (newFactors[i])
+        (*linearFactors)[newFactorsIndices[i]] = newFactors[i]->linearize(theta);
+  };
+#ifdef GTSAM_USE_TBB
+  if (newFactors.size() >= params_.parallelLinearizationThreshold) {
+    TbbOpenMPMixedScope threadLimiter;  // Limits OpenMP threads since we're mixing TBB and OpenMP
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, newFactors.size()),
+                      [&](const tbb::blocked_range<size_t>& range) {
+                        linearizeRange(range.begin(), range.end());
+                      });
+  } else {
+    linearizeRange(0, newFactors.size());
+  }
+#else
+  linearizeRange(0, newFactors.size());
+#endif
+}
+
 }  // namespace gtsam
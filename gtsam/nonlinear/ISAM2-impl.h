@@ -439,49 +439,30 @@ struct GTSAM_EXPORT UpdateImpl {
   /**
    * Apply expmap to the given values, but only for indices appearing in
    * \c mask.  Values are expmapped in-place.
+   * The cost scales with the size of the mask, not with the number of values:
+   * only the masked keys are looked up, and each is retracted in place.
    * \param mask Mask on linear indices, only \c true entries are expmapped
    */
   static void ExpmapMasked(const VectorValues& delta, const KeySet& mask,
                            Values* theta) {
     gttic(ExpmapMasked);
     assert(theta->size() == delta.size());
-    Values::iterator key_value;
-    VectorValues::const_iterator key_delta;
-#ifdef GTSAM_USE_TBB
-    for (key_value = theta->begin(); key_value != theta->end(); ++key_value) {
-      key_delta = delta.find(key_value->key);
-#else
-    for (key_value = theta->begin(), key_delta = delta.begin();
-         key_value != theta->end(); ++key_value, ++key_delta) {
-      assert(key_value->key == key_delta->first);
-#endif
-      Key var = key_value->key;
-      assert(static_cast<size_t>(delta[var].size()) == key_value->value.dim());
-      assert(delta[var].allFinite());
-      if (mask.exists(var)) {
-        Value* retracted = key_value->value.retract_(delta[var]);
-        key_value->value = *retracted;
-        retracted->deallocate_();
-      }
+    for (Key var : mask) {
+      const Values::iterator key_value = theta->find(var);
+      if (key_value == theta->end()) continue;
+      const Vector& d = delta.at(var);
+      assert(static_cast<size_t>(d.size()) == key_value->value.dim());
+      assert(d.allFinite());
+      key_value->value.retractInPlace_(d);
     }
   }
 
-  // Linearize new factors
+  // Linearize new factors straight into their slots in linearFactors, in
+  // parallel if TBB is enabled
   void linearizeNewFactors(const NonlinearFactorGraph& newFactors,
                            const Values& theta, size_t numNonlinearFactors,
                            const FactorIndices& newFactorsIndices,
-                           GaussianFactorGraph* linearFactors) const {
-    gttic(linearizeNewFactors);
-    auto linearized = newFactors.linearize(theta);
-    if (params_.findUnusedFactorSlots) {
-      linearFactors->resize(numNonlinearFactors);
-      for (size_t i = 0; i < newFactors.size(); ++i)
-        (*linearFactors)[newFactorsIndices[i]] = (*linearized)[i];
-    } else {
-      linearFactors->push_back(*linearized);
-    }
-    assert(linearFactors->size() == numNonlinearFactors);
-  }
+                           GaussianFactorGraph* linearFactors) const;
 
   void augmentVariableIndex(const NonlinearFactorGraph& newFactors,
                             const FactorIndices& newFactorsIndices,
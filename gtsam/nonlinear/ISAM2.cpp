@@ -24,10 +24,19 @@
 #include <gtsam/base/timing.h>
 #include <gtsam/inference/BayesTree-inst.h>
 #include <gtsam/nonlinear/LinearContainerFactor.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
 
 #include <algorithm>
+#include <chrono>
 #include <map>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 using namespace std;
 
@@ -38,6 +47,10 @@ template class BayesTree<ISAM2Clique>;
 
 /* ************************************************************************* */
 ISAM2::ISAM2(const ISAM2Params& params) : params_(params), update_count_(0) {
+  if (params_.orderingType != Ordering::COLAMD &&
+      params_.orderingType != Ordering::METIS)
+    throw std::invalid_argument(
+        "ISAM2: only COLAMD and METIS orderings are supported");
   if (params_.optimizationParams.type() == typeid(ISAM2DoglegParams))
     doglegDelta_ =
         boost::get<ISAM2DoglegParams>(params_.optimizationParams).initialDelta;
@@ -73,37 +86,65 @@ GaussianFactorGraph ISAM2::relinearizeAffectedFactors(
   gttoc(affectedKeysSet);
 
   gttic(check_candidates_and_linearize);
-  GaussianFactorGraph linearized;
-  for (const FactorIndex idx : candidates) {
-    bool inside = true;
-    bool useCachedLinear = params_.cacheLinearizedFactors;
-    for (Key key : nonlinearFactors_[idx]->keys()) {
-      if (affectedKeysSet.find(key) == affectedKeysSet.end()) {
-        inside = false;
-        break;
+  // Check and linearize each candidate into its own slot, in parallel if TBB is
+  // enabled, then collect the selected ones in candidate order, so the result
+  // does not depend on the scheduling.
+  const FactorIndices candidateIndices(candidates.begin(), candidates.end());
+  const size_t numCandidates = candidateIndices.size();
+  vector<char> selected(numCandidates, false);
+  vector<GaussianFactor::shared_ptr> linearFactors(numCandidates);
+  auto checkAndLinearize = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const FactorIndex idx = candidateIndices[i];
+      bool inside = true;
+      bool useCachedLinear = params_.cacheLinearizedFactors;
+      for (Key key : nonlinearFactors_[idx]->keys()) {
+        if (affectedKeysSet.find(key) == affectedKeysSet.end()) {
+          inside = false;
+          break;
+        }
+        if (useCachedLinear && relinKeys.find(key) != relinKeys.end())
+          useCachedLinear = false;
       }
-      if (useCachedLinear && relinKeys.find(key) != relinKeys.end())
-        useCachedLinear = false;
-    }
-    if (inside) {
+      if (!inside) continue;
+      selected[i] = true;
       if (useCachedLinear) {
 #ifdef GTSAM_EXTRA_CONSISTENCY_CHECKS
         assert(linearFactors_[idx]);
         assert(linearFactors_[idx]->keys() == nonlinearFactors_[idx]->keys());
 #endif
-        linearized.push_back(linearFactors_[idx]);
+        linearFactors[i] = linearFactors_[idx];
       } else {
         auto linearFactor = nonlinearFactors_[idx]->linearize(theta_);
-        linearized.push_back(linearFactor);
+        linearFactors[i] = linearFactor;
         if (params_.cacheLinearizedFactors) {
 #ifdef GTSAM_EXTRA_CONSISTENCY_CHECKS
           assert(linearFactors_[idx]->keys() == linearFactor->keys());
 #endif
+          // Each candidate owns its slot, so this is safe in parallel
           linearFactors_[idx] = linearFactor;
         }
       }
     }
+  };
+#ifdef GTSAM_USE_TBB
+  if (numCandidates >= params_.parallelLinearizationThreshold) {
+    TbbOpenMPMixedScope threadLimiter;  // Limits OpenMP threads since we're mixing TBB and OpenMP
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numCandidates),
+                      [&](const tbb::blocked_range<size_t>& range) {
+                        checkAndLinearize(range.begin(), range.end());
+                      });
+  } else {
+    checkAndLinearize(0, numCandidates);
   }
+#else
+  checkAndLinearize(0, numCandidates);
+#endif
+
+  GaussianFactorGraph linearized;
+  linearized.reserve(numCandidates);
+  for (size_t i = 0; i < numCandidates; ++i)
+    if (selected[i]) linearized.push_back(linearFactors[i]);
   gttoc(check_candidates_and_linearize);
 
   return linearized;
@@ -192,19 +233,21 @@ void ISAM2::recalculateBatch(const ISAM2UpdateParams& updateParams,
 
   gttic(ordering);
   Ordering order;
+  FastMap<Key, int> constraintGroups;
   if (updateParams.constrainedKeys) {
+    constraintGroups = *updateParams.constrainedKeys;
+  } else if (theta_.size() > result->observedKeys.size()) {
+    // Only if some variables are unconstrained
+    for (Key var : result->observedKeys) constraintGroups[var] = 1;
+  }
+  if (params_.orderingType == Ordering::METIS) {
+    // The non-null factors are exactly the ones in affectedFactorsVarIndex
+    order = Ordering::MetisConstrained(nonlinearFactors_, constraintGroups);
+  } else if (!constraintGroups.empty()) {
     order = Ordering::ColamdConstrained(affectedFactorsVarIndex,
-                                        *updateParams.constrainedKeys);
+                                        constraintGroups);
   } else {
-    if (theta_.size() > result->observedKeys.size()) {
-      // Only if some variables are unconstrained
-      FastMap<Key, int> constraintGroups;
-      for (Key var : result->observedKeys) constraintGroups[var] = 1;
-      order = Ordering::ColamdConstrained(affectedFactorsVarIndex,
-                                          constraintGroups);
-    } else {
-      order = Ordering::Colamd(affectedFactorsVarIndex);
-    }
+    order = Ordering::Colamd(affectedFactorsVarIndex);
   }
   gttoc(ordering);
 
@@ -217,7 +260,8 @@ void ISAM2::recalculateBatch(const ISAM2UpdateParams& updateParams,
   ISAM2BayesTree::shared_ptr bayesTree =
       ISAM2JunctionTree(
           GaussianEliminationTree(*linearized, affectedFactorsVarIndex, order))
-          .eliminate(params_.getEliminationFunction())
+          .eliminate(params_.getEliminationFunction(),
+                     params_.parallelEliminationThreshold)
           .first;
   gttoc(eliminate);
 
@@ -337,13 +381,17 @@ void ISAM2::recalculateIncremental(const ISAM2UpdateParams& updateParams,
   // Generate ordering
   gttic(Ordering);
   const Ordering ordering =
-      Ordering::ColamdConstrained(affectedFactorsVarIndex, constraintGroups);
+      params_.orderingType == Ordering::METIS
+          ? Ordering::MetisConstrained(factors, constraintGroups)
+          : Ordering::ColamdConstrained(affectedFactorsVarIndex,
+                                        constraintGroups);
   gttoc(Ordering);
 
   // Do elimination
   GaussianEliminationTree etree(factors, affectedFactorsVarIndex, ordering);
   auto bayesTree = ISAM2JunctionTree(etree)
-                       .eliminate(params_.getEliminationFunction())
+                       .eliminate(params_.getEliminationFunction(),
+                                  params_.parallelEliminationThreshold)
                        .first;
   gttoc(reorder_and_eliminate);
 
@@ -454,7 +502,12 @@ ISAM2Result ISAM2::update(const NonlinearFactorGraph& newFactors,
       update.findFluid(roots_, relinKeys, &result.markedKeys, result.details());
       // 6. Update linearization point for marked variables:
       // \Theta_{J}:=\Theta_{J}+\Delta_{J}.
+      const auto retractStart = std::chrono::steady_clock::now();
       UpdateImpl::ExpmapMasked(delta_, relinKeys, &theta_);
+      result.retractTime = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - retractStart)
+                               .count();
+      result.variablesRetracted = relinKeys.size();
     }
     result.variablesRelinearized = result.markedKeys.size();
   }
@@ -625,7 +678,8 @@ void ISAM2::marginalizeLeaves(
         if (eliminationResult1.second)
           marginalFactors[cg->front()].push_back(eliminationResult1.second);
 
-        // Split the current clique
+        // Split the current clique, which invalidates its cached marginals
+        clique->deleteCachedShortcuts();
         // Find the position of the last leaf key in this clique
         DenseIndex nToRemove = 0;
         while (leafKeys.exists(cg->keys()[nToRemove])) ++nToRemove;
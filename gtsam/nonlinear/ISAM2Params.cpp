@@ -18,6 +18,8 @@
 #include <gtsam/nonlinear/ISAM2Params.h>
 #include <boost/algorithm/string.hpp>
 
+#include <stdexcept>
+
 using namespace std;
 
 namespace gtsam {
@@ -86,4 +88,26 @@ string ISAM2Params::factorizationTranslator(
   return s;
 }
 
+/* ************************************************************************* */
+Ordering::OrderingType ISAM2Params::orderingTypeTranslator(const string& str) {
+  string s = str;
+  boost::algorithm::to_upper(s);
+  if (s == "COLAMD") return Ordering::COLAMD;
+  if (s == "METIS") return Ordering::METIS;
+  throw invalid_argument("ISAM2Params: only COLAMD and METIS orderings are supported, got " +
+                         str);
+}
+
+/* ************************************************************************* */
+string ISAM2Params::orderingTypeTranslator(const Ordering::OrderingType& value) {
+  switch (value) {
+    case Ordering::COLAMD:
+      return "COLAMD";
+    case Ordering::METIS:
+      return "METIS";
+    default:
+      return "UNDEFINED";
+  }
+}
+
 }  // namespace gtsam
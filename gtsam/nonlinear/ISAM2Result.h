@@ -75,6 +75,17 @@ struct ISAM2Result {
    */
   size_t variablesRelinearized;
 
+  /** The number of variables whose linearization point was updated in this
+   * step, i.e. those above the relinearization threshold, not counting the
+   * ones only involved with them. */
+  size_t variablesRetracted;
+
+  /** The wall-clock time in seconds spent updating those linearization
+   * points. Together with variablesRetracted this shows the cost of the
+   * masked retraction, which should scale with the number of relinearized
+   * variables and not with the size of the problem. */
+  double retractTime;
+
   /** The number of variables that were reeliminated as parts of the Bayes'
    * Tree were recalculated, due to new factors.  When loop closures occur,
    * this count will be large as the new loop-closing factors will tend to
@@ -157,7 +168,8 @@ struct ISAM2Result {
    * Detail for information about the results data stored here. */
   boost::optional<DetailedResults> detail;
 
-  explicit ISAM2Result(bool enableDetailedResults = false) {
+  explicit ISAM2Result(bool enableDetailedResults = false)
+      : variablesRetracted(0), retractTime(0.0) {
     if (enableDetailedResults) detail.reset(DetailedResults());
   }
 
@@ -175,6 +187,8 @@ struct ISAM2Result {
   /** Getters and Setters */
   size_t getVariablesRelinearized() const { return variablesRelinearized; }
   size_t getVariablesReeliminated() const { return variablesReeliminated; }
+  size_t getVariablesRetracted() const { return variablesRetracted; }
+  double getRetractTime() const { return retractTime; }
   size_t getCliques() const { return cliques; }
 };
 
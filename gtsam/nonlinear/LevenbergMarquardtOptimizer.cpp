@@ -23,6 +23,8 @@
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/nonlinear/Values.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/linearExceptions.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/base/Vector.h>
@@ -82,6 +84,11 @@ int LevenbergMarquardtOptimizer::getInnerIterations() const {
 
 /* ************************************************************************* */
 GaussianFactorGraph::shared_ptr LevenbergMarquardtOptimizer::linearize() const {
+  if (params_.relinearizeThreshold > 0.0) {
+    if (!linearizationCache_)
+      linearizationCache_ = boost::make_shared<LinearizationCache>(params_.relinearizeThreshold);
+    return linearizationCache_->linearize(graph_, state_->values);
+  }
   return graph_.linearize(state_->values);
 }
 
@@ -100,6 +107,70 @@ GaussianFactorGraph LevenbergMarquardtOptimizer::buildDampedSystem(
     return currentState->buildDampedSystem(linear);
 }
 
+/* ************************************************************************* */
+// Eliminate the frontal keys of an undamped clique, adding the damping for those keys directly
+// to the diagonal of the joint Hessian instead of appending a prior factor per key.
+static GaussianFactorGraph::EliminationResult EliminateDamped(const GaussianFactorGraph& factors,
+                                                              const Ordering& keys,
+                                                              const VectorValues& damping,
+                                                              bool useCholesky) {
+  gttic(EliminateDamped);
+  if (useCholesky && !hasConstraints(factors)) {
+    Scatter scatter(factors, keys);
+    bool frontalsInvolved = true;
+    for (size_t j = 0; j < keys.size(); ++j)
+      frontalsInvolved = frontalsInvolved && scatter[j].dimension > 0;
+    if (frontalsInvolved) {
+      auto jointFactor = boost::make_shared<HessianFactor>(factors, scatter);
+      for (size_t j = 0; j < keys.size(); ++j) {
+        auto it = damping.find(keys[j]);
+        if (it != damping.end())
+          jointFactor->info().updateDiagonalBlockDiagonal(j, it->second);
+      }
+      auto conditional = jointFactor->eliminateCholesky(keys);
+      return make_pair(conditional, jointFactor);
+    }
+  }
+
+  // Otherwise (QR, constrained noise models, or variables only constrained by the damping)
+  // append the damping as priors, just like buildDampedSystem does.
+  GaussianFactorGraph damped(factors);
+  damped.reserve(factors.size() + keys.size());
+  for (Key key : keys) {
+    auto it = damping.find(key);
+    if (it != damping.end()) {
+      const size_t dim = it->second.size();
+      damped += boost::make_shared<JacobianFactor>(key, Matrix(it->second.cwiseSqrt().asDiagonal()),
+                                                   Vector::Zero(dim));
+    }
+  }
+  return useCholesky ? EliminatePreferCholesky(damped, keys) : EliminateQR(damped, keys);
+}
+
+/* ************************************************************************* */
+VectorValues LevenbergMarquardtOptimizer::solveDamped(const GaussianFactorGraph& linear,
+                                                      const VectorValues& sqrtHessianDiagonal) {
+  gttic(solveDamped);
+  auto currentState = static_cast<const State*>(state_.get());
+
+  // The symbolic structure only depends on the graph, so (re-)build it only when needed
+  if (!eliminationPlan_ || !eliminationPlan_->matches(linear))
+    eliminationPlan_ = boost::make_shared<GaussianEliminationPlan>(linear, *params_.ordering);
+
+  if (params_.verbosityLM >= LevenbergMarquardtParams::DAMPED)
+    std::cout << "eliminating damped system with lambda " << currentState->lambda << std::endl;
+
+  const VectorValues damping = params_.diagonalDamping
+                                   ? currentState->dampingDiagonal(sqrtHessianDiagonal)
+                                   : currentState->dampingDiagonal();
+  const bool useCholesky =
+      params_.linearSolverType == NonlinearOptimizerParams::MULTIFRONTAL_CHOLESKY;
+  return eliminationPlan_->optimize(
+      linear, [&](const GaussianFactorGraph& factors, const Ordering& keys) {
+        return EliminateDamped(factors, keys, damping, useCholesky);
+      }, params_.parallelEliminationThreshold);
+}
+
 /* ************************************************************************* */
 // Log current error/lambda to file
 inline void LevenbergMarquardtOptimizer::writeLogFile(double currentError){
@@ -132,8 +203,13 @@ bool LevenbergMarquardtOptimizer::tryLambda(const GaussianFactorGraph& linear,
   if (verbose)
     cout << "trying lambda = " << currentState->lambda << endl;
 
-  // Build damped system for this lambda (adds prior factors that make it like gradient descent)
-  auto dampedSystem = buildDampedSystem(linear, sqrtHessianDiagonal);
+  // Build damped system for this lambda (adds prior factors that make it like gradient descent),
+  // unless the damping is added during elimination with a cached elimination plan
+  const bool dampDuringElimination =
+      params_.reuseEliminationStructure && params_.isMultifrontal();
+  GaussianFactorGraph dampedSystem;
+  if (!dampDuringElimination)
+    dampedSystem = buildDampedSystem(linear, sqrtHessianDiagonal);
 
   // Try solving
   double modelFidelity = 0.0;
@@ -146,7 +222,10 @@ bool LevenbergMarquardtOptimizer::tryLambda(const GaussianFactorGraph& linear,
   bool systemSolvedSuccessfully;
   try {
     // ============ Solve is where most computation happens !! =================
-    delta = solve(dampedSystem, params_);
+    if (dampDuringElimination)
+      delta = solveDamped(linear, sqrtHessianDiagonal);
+    else
+      delta = solve(dampedSystem, params_);
     systemSolvedSuccessfully = true;
   } catch (const IndeterminantLinearSystemException&) {
     systemSolvedSuccessfully = false;
@@ -22,6 +22,8 @@
 
 #include <gtsam/nonlinear/NonlinearOptimizer.h>
 #include <gtsam/nonlinear/LevenbergMarquardtParams.h>
+#include <gtsam/nonlinear/LinearizationCache.h>
+#include <gtsam/linear/GaussianEliminationPlan.h>
 #include <gtsam/linear/VectorValues.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
@@ -37,6 +39,8 @@ class GTSAM_EXPORT LevenbergMarquardtOptimizer: public NonlinearOptimizer {
 protected:
   const LevenbergMarquardtParams params_; ///< LM parameters
   boost::posix_time::ptime startTime_;
+  GaussianEliminationPlan::shared_ptr eliminationPlan_; ///< cached if reuseEliminationStructure
+  mutable LinearizationCache::shared_ptr linearizationCache_; ///< used if relinearizeThreshold > 0
 
   void initTime();
 
@@ -114,6 +118,13 @@ public:
   GaussianFactorGraph buildDampedSystem(const GaussianFactorGraph& linear,
                                         const VectorValues& sqrtHessianDiagonal) const;
 
+  /**
+   * Solve the damped system using the cached elimination plan, adding the damping to the
+   * diagonal of the Hessian during elimination. Used if reuseEliminationStructure is set.
+   */
+  VectorValues solveDamped(const GaussianFactorGraph& linear,
+                           const VectorValues& sqrtHessianDiagonal);
+
   /** Inner loop, changes state, returns true if successful or giving up */
   bool tryLambda(const GaussianFactorGraph& linear, const VectorValues& sqrtHessianDiagonal);
 
@@ -99,6 +99,8 @@ void LevenbergMarquardtParams::print(const std::string& str) const {
   std::cout << "            diagonalDamping: " << diagonalDamping << "\n";
   std::cout << "                minDiagonal: " << minDiagonal << "\n";
   std::cout << "                maxDiagonal: " << maxDiagonal << "\n";
+  std::cout << "  reuseEliminationStructure: " << reuseEliminationStructure << "\n";
+  std::cout << "       relinearizeThreshold: " << relinearizeThreshold << "\n";
   std::cout << "                verbosityLM: "
       << verbosityLMTranslator(verbosityLM) << "\n";
   std::cout.flush();
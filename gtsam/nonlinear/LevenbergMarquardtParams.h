@@ -54,12 +54,16 @@ public:
   bool useFixedLambdaFactor; ///< if true applies constant increase (or decrease) to lambda according to lambdaFactor
   double minDiagonal; ///< when using diagonal damping saturates the minimum diagonal entries (default: 1e-6)
   double maxDiagonal; ///< when using diagonal damping saturates the maximum diagonal entries (default: 1e32)
+  bool reuseEliminationStructure; ///< if true, multifrontal solvers cache the junction tree across iterations and add damping to the Hessian diagonal during elimination (default: false)
+  double relinearizeThreshold; ///< if positive, only relinearize factors involving a variable that moved at least this much since its last linearization, see LinearizationCache (default: 0)
 
   LevenbergMarquardtParams()
       : verbosityLM(SILENT),
         diagonalDamping(false),
         minDiagonal(1e-6),
-        maxDiagonal(1e32) {
+        maxDiagonal(1e32),
+        reuseEliminationStructure(false),
+        relinearizeThreshold(0.0) {
     SetLegacyDefaults(this);
   }
 
@@ -130,6 +134,8 @@ public:
   double getlambdaLowerBound() const { return lambdaLowerBound; }
   double getlambdaUpperBound() const { return lambdaUpperBound; }
   bool getUseFixedLambdaFactor() { return useFixedLambdaFactor; }
+  bool getReuseEliminationStructure() const { return reuseEliminationStructure; }
+  double getRelinearizeThreshold() const { return relinearizeThreshold; }
   std::string getLogFile() const { return logFile; }
   std::string getVerbosityLM() const { return verbosityLMTranslator(verbosityLM);}
   
@@ -139,6 +145,8 @@ public:
   void setlambdaLowerBound(double value) { lambdaLowerBound = value; }
   void setlambdaUpperBound(double value) { lambdaUpperBound = value; }
   void setUseFixedLambdaFactor(bool flag) { useFixedLambdaFactor = flag;}
+  void setReuseEliminationStructure(bool flag) { reuseEliminationStructure = flag; }
+  void setRelinearizeThreshold(double value) { relinearizeThreshold = value; }
   void setLogFile(const std::string& s) { logFile = s; }
   void setVerbosityLM(const std::string& s) { verbosityLM = verbosityLMTranslator(s);}
   // @}
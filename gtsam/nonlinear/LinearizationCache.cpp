@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file LinearizationCache.cpp
+ * @brief Re-uses the linearization of factors whose variables barely moved, as in ISAM2
+ * @date Oct 2026
+ */
+
+#include <gtsam/nonlinear/LinearizationCache.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#  include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
+
+using namespace std;
+
+namespace gtsam {
+
+  /* ************************************************************************* */
+  namespace {
+
+    // Re-express a linear factor in terms of an update that starts d away from its
+    // linearization point, returns null if the factor type is not supported
+    GaussianFactor::shared_ptr shifted(const GaussianFactor::shared_ptr& factor,
+                                       const Vector& d) {
+      if (const JacobianFactor::shared_ptr jacobian =
+              boost::dynamic_pointer_cast<JacobianFactor>(factor)) {
+        // |A (d + delta) - b| = |A delta - (b - A d)|
+        JacobianFactor::shared_ptr result = boost::make_shared<JacobianFactor>(*jacobian);
+        result->getb() -= jacobian->getA() * d;
+        return result;
+      } else if (const HessianFactor::shared_ptr hessian =
+                     boost::dynamic_pointer_cast<HessianFactor>(factor)) {
+        // 0.5 (d + delta)' G (d + delta) - (d + delta)' g + 0.5 f
+        //   = 0.5 delta' G delta - delta' (g - G d) + 0.5 (f + d' G d - 2 d' g)
+        HessianFactor::shared_ptr result = boost::make_shared<HessianFactor>(*hessian);
+        const Vector Gd = hessian->information() * d;
+        const double dg = d.dot(hessian->linearTerm().col(0));
+        result->linearTerm() -= Gd;
+        result->constantTerm() += d.dot(Gd) - 2.0 * dg;
+        return result;
+      } else {
+        return GaussianFactor::shared_ptr();
+      }
+    }
+
+#ifdef GTSAM_USE_TBB
+    class _LinearizeSomeFactors {
+      const NonlinearFactorGraph& nonlinearGraph_;
+      const Values& linearizationPoint_;
+      const vector<size_t>& indices_;
+      GaussianFactorGraph& result_;
+    public:
+      // Create functor with constant parameters
+      _LinearizeSomeFactors(const NonlinearFactorGraph& graph, const Values& linearizationPoint,
+                            const vector<size_t>& indices, GaussianFactorGraph& result) :
+          nonlinearGraph_(graph), linearizationPoint_(linearizationPoint), indices_(indices),
+          result_(result) {
+      }
+      // Operator that linearizes the factors with the given range of indices
+      void operator()(const tbb::blocked_range<size_t>& blocked_range) const {
+        for (size_t i = blocked_range.begin(); i != blocked_range.end(); ++i)
+          result_[indices_[i]] = nonlinearGraph_[indices_[i]]->linearize(linearizationPoint_);
+      }
+    };
+#endif
+
+  }
+
+  /* ************************************************************************* */
+  GaussianFactorGraph::shared_ptr LinearizationCache::linearize(
+      const NonlinearFactorGraph& graph, const Values& values) {
+    gttic(LinearizationCache_linearize);
+    if (factors_.size() != graph.size()) {
+      clear();
+      factors_.resize(graph.size());
+    }
+
+    // Move the linearization point of variables that moved too far, and keep the local
+    // coordinates of the current values for the others
+    gttic(check_relinearization);
+    KeySet relinearizedKeys;
+    VectorValues offsets;
+    for (const Values::ConstKeyValuePair& key_value : values) {
+      const Key key = key_value.key;
+      if (!linearizationPoint_.exists(key)) {
+        linearizationPoint_.insert(key, key_value.value);
+        relinearizedKeys.insert(key);
+        continue;
+      }
+      const Vector d = linearizationPoint_.at(key).localCoordinates_(key_value.value);
+      if (d.size() > 0 && d.lpNorm<Eigen::Infinity>() >= relinearizeThreshold_) {
+        linearizationPoint_.update(key, key_value.value);
+        relinearizedKeys.insert(key);
+      } else if (!d.isZero(0.0)) {
+        offsets.insert(key, d);
+      }
+    }
+    gttoc(check_relinearization);
+
+    // Relinearize the factors involving a relinearized variable
+    gttic(relinearize);
+    vector<size_t> indices;
+    for (size_t i = 0; i < graph.size(); ++i) {
+      if (!graph[i]) {
+        factors_[i].reset();
+        continue;
+      }
+      bool relinearize = !factors_[i];
+      for (Key key : *graph[i])
+        relinearize = relinearize || relinearizedKeys.exists(key);
+      if (relinearize)
+        indices.push_back(i);
+    }
+#ifdef GTSAM_USE_TBB
+    TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, indices.size()),
+      _LinearizeSomeFactors(graph, linearizationPoint_, indices, factors_));
+#else
+    for (size_t i : indices)
+      factors_[i] = graph[i]->linearize(linearizationPoint_);
+#endif
+    nrRelinearized_ = indices.size();
+    gttoc(relinearize);
+
+    // Shift the factors that involve a variable away from its linearization point
+    gttic(shift);
+    GaussianFactorGraph::shared_ptr linearFG = boost::make_shared<GaussianFactorGraph>();
+    linearFG->reserve(graph.size());
+    for (size_t i = 0; i < graph.size(); ++i) {
+      const GaussianFactor::shared_ptr& factor = factors_[i];
+      if (!factor) {
+        *linearFG += GaussianFactor::shared_ptr();
+        continue;
+      }
+      bool needsShift = false;
+      for (Key key : *factor)
+        needsShift = needsShift || offsets.exists(key);
+      if (!needsShift) {
+        *linearFG += factor;
+        continue;
+      }
+      DenseIndex dim = 0;
+      for (GaussianFactor::const_iterator key = factor->begin(); key != factor->end(); ++key)
+        dim += factor->getDim(key);
+      Vector d = Vector::Zero(dim);
+      dim = 0;
+      for (GaussianFactor::const_iterator key = factor->begin(); key != factor->end(); ++key) {
+        const VectorValues::const_iterator offset = offsets.find(*key);
+        if (offset != offsets.end())
+          d.segment(dim, offset->second.size()) = offset->second;
+        dim += factor->getDim(key);
+      }
+      GaussianFactor::shared_ptr shiftedFactor = shifted(factor, d);
+      if (!shiftedFactor) {
+        // Unknown linear factor type, linearize at the current values instead
+        shiftedFactor = graph[i]->linearize(values);
+        ++nrRelinearized_;
+      }
+      *linearFG += shiftedFactor;
+    }
+    gttoc(shift);
+
+    return linearFG;
+  }
+
+  /* ************************************************************************* */
+  void LinearizationCache::clear() {
+    linearizationPoint_.clear();
+    factors_.resize(0);
+    nrRelinearized_ = 0;
+  }
+
+}
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file LinearizationCache.h
+ * @brief Re-uses the linearization of factors whose variables barely moved, as in ISAM2
+ * @date Oct 2026
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+
+namespace gtsam {
+
+  // Forward declarations
+  class NonlinearFactorGraph;
+
+  /**
+   * Fluid relinearization for batch optimization. Like ISAM2, the cache keeps a linearization
+   * point for every variable, and only moves it to the current value once the two differ by at
+   * least relinearizeThreshold in any component of the tangent space. Only the factors that
+   * involve such a variable are relinearized, the others keep their cached linear factor.
+   *
+   * Since the optimizers solve for an update of the current values, the cached factors are
+   * re-expressed in terms of that update: a factor linearized at \f$ x_0 \f$ with variables
+   * currently at \f$ x \f$ is shifted by the local coordinates \f$ d \f$ of \f$ x \f$
+   * around \f$ x_0 \f$, e.g. a Jacobian factor \f$ \|A\delta - b\| \f$ becomes
+   * \f$ \|A\delta - (b - Ad)\| \f$. This is done for JacobianFactor and HessianFactor,
+   * factors that linearize to other types are always relinearized.
+   *
+   * The cache is tied to the factor graph it was first used with: factor i is assumed to be
+   * the same factor in every call. Call clear() when the graph changes.
+   */
+  class GTSAM_EXPORT LinearizationCache {
+  public:
+    typedef boost::shared_ptr<LinearizationCache> shared_ptr; ///< Shared pointer to this class
+
+    /**
+     * @param relinearizeThreshold Variables whose current value differs from their
+     * linearization point by at least this much in any tangent space component are
+     * relinearized, see ISAM2Params::relinearizeThreshold
+     */
+    explicit LinearizationCache(double relinearizeThreshold) :
+      relinearizeThreshold_(relinearizeThreshold), nrRelinearized_(0) {}
+
+    /**
+     * Linearize a factor graph at the given values, relinearizing only the factors whose
+     * variables moved too far from their linearization point.
+     */
+    GaussianFactorGraph::shared_ptr linearize(const NonlinearFactorGraph& graph,
+                                              const Values& values);
+
+    /// The relinearization threshold
+    double relinearizeThreshold() const { return relinearizeThreshold_; }
+
+    /// The current linearization point of each variable
+    const Values& linearizationPoint() const { return linearizationPoint_; }
+
+    /// Number of factors that were relinearized in the last call to linearize
+    size_t nrRelinearized() const { return nrRelinearized_; }
+
+    /// Forget all cached linear factors
+    void clear();
+
+  private:
+    double relinearizeThreshold_;
+    Values linearizationPoint_;      ///< Linearization point of each variable
+    GaussianFactorGraph factors_;    ///< Factors linearized at linearizationPoint_
+    size_t nrRelinearized_;
+  };
+
+}
@@ -17,10 +17,13 @@
  */
 
 #include <gtsam/base/timing.h>
+#include <gtsam/base/treeTraversal-inst.h>
 #include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/HessianFactor.h>
 #include <gtsam/nonlinear/Marginals.h>
 
+#include <unordered_set>
+
 using namespace std;
 
 namespace gtsam {
@@ -137,6 +140,133 @@ JointMarginal Marginals::jointMarginalCovariance(const KeyVector& variables) con
   return info;
 }
 
+/* ************************************************************************* */
+namespace {
+
+// Joint covariance of the frontal and separator variables of a clique, in the
+// order of the keys of its conditional
+struct CliqueCovariance {
+  Matrix covariance;
+  FastMap<Key, pair<DenseIndex, DenseIndex> > blocks;  // offset and dimension of each key
+};
+typedef boost::shared_ptr<CliqueCovariance> CliqueCovariancePtr;
+
+// Pre-order visitor that computes the covariance of a clique from the one of its
+// parent. With x_F = R^-1 (d - S x_S) for the frontal variables F given the
+// separator S, and A = R^-1 S,
+//   Sigma_FS = -A Sigma_SS
+//   Sigma_FF = R^-1 R^-T - Sigma_FS A'
+// where Sigma_SS is a sub-block of the parent covariance.
+class MarginalCovariancesVisitor {
+  const unordered_set<const GaussianBayesTreeClique*>* cliques_;  // null for all cliques
+  FastMap<Key, Matrix>& covariances_;  // holds an entry for each wanted variable
+
+public:
+  MarginalCovariancesVisitor(const unordered_set<const GaussianBayesTreeClique*>* cliques,
+                             FastMap<Key, Matrix>& covariances) :
+      cliques_(cliques), covariances_(covariances) {
+  }
+
+  CliqueCovariancePtr operator()(const GaussianBayesTreeClique::shared_ptr& clique,
+                                 const CliqueCovariancePtr& parent) const {
+    if (cliques_ && !cliques_->count(clique.get()))
+      return CliqueCovariancePtr();
+    const GaussianConditional& conditional = *clique->conditional();
+
+    // Whiten in case the conditional has a non-unit noise model
+    Matrix R = conditional.R(), S = conditional.S();
+    if (conditional.get_model()) {
+      conditional.get_model()->WhitenInPlace(R);
+      conditional.get_model()->WhitenInPlace(S);
+    }
+    const DenseIndex nF = R.cols(), nS = S.cols();
+    const Matrix Rinv = R.triangularView<Eigen::Upper>().solve(Matrix::Identity(nF, nF));
+
+    CliqueCovariancePtr result = boost::make_shared<CliqueCovariance>();
+    result->covariance.resize(nF + nS, nF + nS);
+    result->covariance.topLeftCorner(nF, nF).noalias() = Rinv * Rinv.transpose();
+    if (nS > 0) {
+      // Gather the covariance of the separator from the parent
+      Matrix& sigma = result->covariance;
+      DenseIndex i = nF;
+      for (GaussianConditional::const_iterator key1 = conditional.beginParents();
+           key1 != conditional.endParents(); ++key1) {
+        const pair<DenseIndex, DenseIndex>& block1 = parent->blocks.at(*key1);
+        DenseIndex j = nF;
+        for (GaussianConditional::const_iterator key2 = conditional.beginParents();
+             key2 != conditional.endParents(); ++key2) {
+          const pair<DenseIndex, DenseIndex>& block2 = parent->blocks.at(*key2);
+          sigma.block(i, j, block1.second, block2.second) =
+              parent->covariance.block(block1.first, block2.first, block1.second, block2.second);
+          j += block2.second;
+        }
+        i += block1.second;
+      }
+      const Matrix A = Rinv * S;
+      sigma.topRightCorner(nF, nS).noalias() = -A * sigma.bottomRightCorner(nS, nS);
+      sigma.topLeftCorner(nF, nF).noalias() -= sigma.topRightCorner(nF, nS) * A.transpose();
+      sigma.bottomLeftCorner(nS, nF) = sigma.topRightCorner(nF, nS).transpose();
+    }
+
+    // Store the marginals of the wanted frontal variables
+    DenseIndex offset = 0;
+    for (GaussianConditional::const_iterator key = conditional.begin(); key != conditional.end(); ++key) {
+      const DenseIndex dim = conditional.getDim(key);
+      result->blocks.insert(make_pair(*key, make_pair(offset, dim)));
+      if (key < conditional.endFrontals()) {
+        const FastMap<Key, Matrix>::iterator marginal = covariances_.find(*key);
+        if (marginal != covariances_.end())
+          marginal->second = result->covariance.block(offset, offset, dim, dim);
+      }
+      offset += dim;
+    }
+
+    // Only the children need the joint covariance
+    if (clique->children.empty())
+      return CliqueCovariancePtr();
+    return result;
+  }
+};
+
+}
+
+/* ************************************************************************* */
+FastMap<Key, Matrix> Marginals::marginalCovariances(const KeyVector& variables) const {
+  gttic(marginalCovariances);
+
+  // Mark the cliques on the paths from the roots to the wanted variables
+  FastMap<Key, Matrix> covariances;
+  unordered_set<const GaussianBayesTreeClique*> cliques;
+  for (Key key : variables) {
+    covariances.insert(make_pair(key, Matrix()));
+    GaussianBayesTreeClique::shared_ptr clique = bayesTree_[key];
+    while (clique && cliques.insert(clique.get()).second)
+      clique = clique->parent();
+  }
+
+  CliqueCovariancePtr rootData;
+  MarginalCovariancesVisitor visitor(&cliques, covariances);
+  treeTraversal::no_op postVisitor;
+  TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+  treeTraversal::DepthFirstForestParallel(bayesTree_, rootData, visitor, postVisitor);
+  return covariances;
+}
+
+/* ************************************************************************* */
+FastMap<Key, Matrix> Marginals::marginalCovariances() const {
+  gttic(marginalCovariances);
+  FastMap<Key, Matrix> covariances;
+  for (const GaussianBayesTree::Nodes::value_type& key_clique : bayesTree_.nodes())
+    covariances.insert(make_pair(key_clique.first, Matrix()));
+
+  CliqueCovariancePtr rootData;
+  MarginalCovariancesVisitor visitor(nullptr, covariances);
+  treeTraversal::no_op postVisitor;
+  TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+  treeTraversal::DepthFirstForestParallel(bayesTree_, rootData, visitor, postVisitor);
+  return covariances;
+}
+
 /* ************************************************************************* */
 JointMarginal Marginals::jointMarginalInformation(const KeyVector& variables) const {
 
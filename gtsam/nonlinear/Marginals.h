@@ -116,6 +116,19 @@ public:
   /** Compute the joint marginal covariance of several variables */
   JointMarginal jointMarginalCovariance(const KeyVector& variables) const;
 
+  /** Compute the marginal covariances of many variables at once. Rather than
+   * computing a marginal factor per variable, this recovers the covariance of
+   * each clique from the one of its parent in a single top-down pass over the
+   * Bayes tree, in parallel over subtrees if TBB is enabled, and only visits
+   * the cliques on the paths from the roots to the requested variables.
+   * @param variables The variables whose marginal covariance is wanted
+   * @return The marginal covariance of each of the variables
+   */
+  FastMap<Key, Matrix> marginalCovariances(const KeyVector& variables) const;
+
+  /** Compute the marginal covariances of all variables, see marginalCovariances(const KeyVector&) */
+  FastMap<Key, Matrix> marginalCovariances() const;
+
   /** Compute the joint marginal information of several variables */
   JointMarginal jointMarginalInformation(const KeyVector& variables) const;
 
@@ -249,9 +249,41 @@ void NonlinearFactorGraph::saveGraph(std::ostream &stm, const Values& values,
   stm << "}\n";
 }
 
+/* ************************************************************************* */
+namespace {
+
+#ifdef GTSAM_USE_TBB
+class _ErrorOneFactor {
+  const NonlinearFactorGraph& nonlinearGraph_;
+  const Values& values_;
+  double* result_;
+public:
+  // Create functor with constant parameters
+  _ErrorOneFactor(const NonlinearFactorGraph& graph, const Values& values, double* result) :
+      nonlinearGraph_(graph), values_(values), result_(result) {
+  }
+  // Operator that evaluates the errors of a given range of the factors
+  void operator()(const tbb::blocked_range<size_t>& blocked_range) const {
+    for (size_t i = blocked_range.begin(); i != blocked_range.end(); ++i)
+      result_[i] = nonlinearGraph_[i] ? nonlinearGraph_[i]->error(values_) : 0.0;
+  }
+};
+#endif
+
+}
+
 /* ************************************************************************* */
 double NonlinearFactorGraph::error(const Values& values) const {
   gttic(NonlinearFactorGraph_error);
+#ifdef GTSAM_USE_TBB
+  // Evaluate the factors in parallel, but sum in factor order so that the result does not depend
+  // on how the work was split between threads
+  const Vector factorErrors = errors(values);
+  double total_error = 0.;
+  for (size_t i = 0; i < size(); ++i)
+    total_error += factorErrors[i];
+  return total_error;
+#else
   double total_error = 0.;
   // iterate over all the factors_ to accumulate the log probabilities
   for(const sharedFactor& factor: factors_) {
@@ -259,6 +291,27 @@ double NonlinearFactorGraph::error(const Values& values) const {
       total_error += factor->error(values);
   }
   return total_error;
+#endif
+}
+
+/* ************************************************************************* */
+void NonlinearFactorGraph::errors(const Values& values, double* result) const {
+  gttic(NonlinearFactorGraph_errors);
+#ifdef GTSAM_USE_TBB
+  TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, size()),
+    _ErrorOneFactor(*this, values, result));
+#else
+  for (size_t i = 0; i < size(); ++i)
+    result[i] = factors_[i] ? factors_[i]->error(values) : 0.0;
+#endif
+}
+
+/* ************************************************************************* */
+Vector NonlinearFactorGraph::errors(const Values& values) const {
+  Vector result(size());
+  errors(values, result.data());
+  return result;
 }
 
 /* ************************************************************************* */
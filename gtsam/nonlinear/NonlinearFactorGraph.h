@@ -119,6 +119,17 @@ namespace gtsam {
     /** unnormalized error, \f$ 0.5 \sum_i (h_i(X_i)-z)^2/\sigma^2 \f$ in the most common case */
     double error(const Values& values) const;
 
+    /**
+     * Errors of the individual factors, the i^th entry being the error of the i^th factor or zero
+     * for null factors. With TBB the factors are evaluated in parallel.
+     * @param values The values to evaluate the factors at
+     * @param result Pre-allocated buffer with room for size() entries
+     */
+    void errors(const Values& values, double* result) const;
+
+    /** Errors of the individual factors, see errors(const Values&, double*) */
+    Vector errors(const Values& values) const;
+
     /** Unnormalized probability. O(n) */
     double probPrime(const Values& values) const;
 
@@ -22,6 +22,7 @@
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/linear/SubgraphSolver.h>
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/SparseCholeskySolver.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/VectorValues.h>
 
@@ -133,9 +134,11 @@ VectorValues NonlinearOptimizer::solve(const GaussianFactorGraph& gfg,
   if (params.isMultifrontal()) {
     // Multifrontal QR or Cholesky (decided by params.getEliminationFunction())
     if (params.ordering)
-      delta = gfg.optimize(*params.ordering, params.getEliminationFunction());
+      delta = gfg.optimize(*params.ordering, params.getEliminationFunction(),
+                           params.parallelEliminationThreshold);
     else
-      delta = gfg.optimize(params.getEliminationFunction());
+      delta = gfg.optimize(params.getEliminationFunction(),
+                           params.parallelEliminationThreshold);
   } else if (params.isSequential()) {
     // Sequential QR or Cholesky (decided by params.getEliminationFunction())
     if (params.ordering)
@@ -144,6 +147,13 @@ VectorValues NonlinearOptimizer::solve(const GaussianFactorGraph& gfg,
     else
       delta = gfg.eliminateSequential(params.getEliminationFunction(), boost::none,
                                       params.orderingType)->optimize();
+  } else if (params.isCholmod()) {
+    // Sparse Cholesky on the assembled Hessian, in the given or a fill-reducing ordering
+    const Ordering ordering =
+        params.ordering ? *params.ordering : Ordering::Create(params.orderingType, gfg);
+    if (!sparseCholeskySolver_ || !sparseCholeskySolver_->ordering().equals(ordering))
+      sparseCholeskySolver_ = boost::make_shared<SparseCholeskySolver>(ordering);
+    delta = sparseCholeskySolver_->optimize(gfg);
   } else if (params.isIterative()) {
     // Conjugate Gradient -> needs params.iterativeParams
     if (!params.iterativeParams)
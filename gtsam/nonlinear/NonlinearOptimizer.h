@@ -24,6 +24,7 @@
 namespace gtsam {
 
 namespace internal { struct NonlinearOptimizerState; }
+class SparseCholeskySolver;
 
 /**
  * This is the abstract interface for classes that can optimize for the
@@ -79,6 +80,9 @@ protected:
 
   std::unique_ptr<internal::NonlinearOptimizerState> state_; ///< PIMPL'd state
 
+  /// Cached so its symbolic analysis is re-used when linearSolverType is CHOLMOD
+  mutable boost::shared_ptr<SparseCholeskySolver> sparseCholeskySolver_;
+
 public:
   /** A shared pointer to this class */
   typedef boost::shared_ptr<const NonlinearOptimizer> shared_ptr;
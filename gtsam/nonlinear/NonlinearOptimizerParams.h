@@ -44,11 +44,12 @@ public:
   double errorTol; ///< The maximum total error to stop iterating (default 0.0)
   Verbosity verbosity; ///< The printing verbosity during optimization (default SILENT)
   Ordering::OrderingType orderingType; ///< The method of ordering use during variable elimination (default COLAMD)
+  double parallelEliminationThreshold; ///< With TBB, multifrontal elimination subtrees with a smaller estimated cost are eliminated in a single task (default 1e5 flops)
 
   NonlinearOptimizerParams() :
       maxIterations(100), relativeErrorTol(1e-5), absoluteErrorTol(1e-5), errorTol(
           0.0), verbosity(SILENT), orderingType(Ordering::COLAMD),
-          linearSolverType(MULTIFRONTAL_CHOLESKY) {}
+          parallelEliminationThreshold(1e5), linearSolverType(MULTIFRONTAL_CHOLESKY) {}
 
   virtual ~NonlinearOptimizerParams() {
   }
@@ -59,6 +60,7 @@ public:
   double getAbsoluteErrorTol() const { return absoluteErrorTol; }
   double getErrorTol() const { return errorTol; }
   std::string getVerbosity() const { return verbosityTranslator(verbosity); }
+  double getParallelEliminationThreshold() const { return parallelEliminationThreshold; }
 
   void setMaxIterations(int value) { maxIterations = value; }
   void setRelativeErrorTol(double value) { relativeErrorTol = value; }
@@ -67,6 +69,7 @@ public:
   void setVerbosity(const std::string& src) {
     verbosity = verbosityTranslator(src);
   }
+  void setParallelEliminationThreshold(double value) { parallelEliminationThreshold = value; }
 
   static Verbosity verbosityTranslator(const std::string &s) ;
   static std::string verbosityTranslator(Verbosity value) ;
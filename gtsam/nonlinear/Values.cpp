@@ -35,9 +35,12 @@
 #endif
 #include <boost/iterator/transform_iterator.hpp>
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <sstream>
+#include <typeinfo>
+#include <vector>
 
 using namespace std;
 
@@ -45,26 +48,90 @@ namespace gtsam {
 
   /* ************************************************************************* */
   Values::Values(const Values& other) {
-    this->insert(other);
+    // Keys arrive in order, so each one goes at the end of the map
+    for (const_iterator key_value = other.begin(); key_value != other.end(); ++key_value) {
+      Key key = key_value->key;  // Non-const duplicate to deal with non-const insert argument
+      values_.insert(values_.end(), key, key_value->value.clone_());
+    }
   }
 
   /* ************************************************************************* */
   Values::Values(Values&& other) : values_(std::move(other.values_)) {
   }
 
+  /* ************************************************************************* */
+  namespace {
+    // Consecutive updated variables of the same concrete type, retracted with one call
+    class RetractRun {
+    public:
+      enum { MaxSize = 256 };
+
+      RetractRun() : size_(0) {}
+
+      bool accepts(const Value& value) const {
+        return size_ == 0 || (size_ < MaxSize && typeid(*values_[0]) == typeid(value));
+      }
+
+      void add(Key key, const Value& value, const Vector& delta) {
+        keys_[size_] = key;
+        values_[size_] = &value;
+        deltas_[size_] = &delta;
+        ++size_;
+      }
+
+      // Retract the run and append the results to the map, as keys arrive in order
+      template <class MAP>
+      void flush(MAP& map) {
+        if (size_ == 0) return;
+        const size_t n = size_;
+        size_ = 0;
+        std::fill(result_, result_ + n, nullptr);
+        try {
+          values_[0]->retractBatch_(n, values_, deltas_, result_);
+        } catch (...) {
+          for (size_t i = 0; i < n; ++i)
+            if (result_[i]) result_[i]->deallocate_();
+          throw;
+        }
+        for (size_t i = 0; i < n; ++i) {
+          try {
+            map.insert(map.end(), keys_[i], result_[i]);
+          } catch (...) {
+            // The map deletes the value it failed to insert, but not the ones after it
+            for (size_t j = i + 1; j < n; ++j)
+              result_[j]->deallocate_();
+            throw;
+          }
+        }
+      }
+
+    private:
+      size_t size_;
+      Key keys_[MaxSize];
+      const Value* values_[MaxSize];
+      const Vector* deltas_[MaxSize];
+      Value* result_[MaxSize];
+    };
+  }
+
   /* ************************************************************************* */
   Values::Values(const Values& other, const VectorValues& delta) {
+    // Retract runs of variables of the same type with the batch kernel of their type,
+    // which for a Values ordered by symbol are long runs of poses or points
+    RetractRun run;
     for (const_iterator key_value = other.begin(); key_value != other.end(); ++key_value) {
       VectorValues::const_iterator it = delta.find(key_value->key);
-      Key key = key_value->key;  // Non-const duplicate to deal with non-const insert argument
-      if (it != delta.end()) {
-        const Vector& v = it->second;
-        Value* retractedValue(key_value->value.retract_(v));  // Retract
-        values_.insert(key, retractedValue);  // Add retracted result directly to result values
-      } else {
-        values_.insert(key, key_value->value.clone_());  // Add original version to result values
+      if (it == delta.end()) {
+        run.flush(values_);
+        Key key = key_value->key;  // Non-const duplicate to deal with non-const insert argument
+        values_.insert(values_.end(), key, key_value->value.clone_());
+        continue;
       }
+      if (!run.accepts(key_value->value))
+        run.flush(values_);
+      run.add(key_value->key, key_value->value, it->second);
     }
+    run.flush(values_);
   }
 
   /* ************************************************************************* */
@@ -191,8 +258,10 @@ namespace gtsam {
 
   /* ************************************************************************* */
   Values& Values::operator=(const Values& rhs) {
-    this->clear();
-    this->insert(rhs);
+    if (this != &rhs) {
+      Values copy(rhs);
+      values_.swap(copy.values_);
+    }
     return *this;
   }
 
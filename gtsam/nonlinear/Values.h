@@ -75,7 +75,8 @@ namespace gtsam {
     // Internally we store a boost ptr_map, with a ValueCloneAllocator (defined
     // below) to clone and deallocate the Value objects, and a boost
     // fast_pool_allocator to allocate map nodes.  In this way, all memory is
-    // allocated in a boost memory pool.
+    // allocated in a boost memory pool.  With GTSAM_VALUES_ARENA, the cloned
+    // values themselves come from a contiguous arena per type, see ValueArena.h.
     typedef boost::ptr_map<
         Key,
         Value,
@@ -20,6 +20,7 @@
 
 #include <gtsam/nonlinear/Values.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
 #include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/NoiseModel.h>
 #include <gtsam/base/Matrix.h>
@@ -153,6 +154,22 @@ struct LevenbergMarquardtState : public NonlinearOptimizerState {
     }
     return damped;
   }
+
+  /// Damping to add to the Hessian diagonal of each variable, vanilla version
+  VectorValues dampingDiagonal() const {
+    VectorValues damping;
+    for (const auto& key_value : values)
+      damping.emplace(key_value.key, Vector::Constant(key_value.value.dim(), lambda));
+    return damping;
+  }
+
+  /// Damping to add to the Hessian diagonal of each variable, using hessianDiagonal
+  VectorValues dampingDiagonal(const VectorValues& sqrtHessianDiagonal) const {
+    VectorValues damping;
+    for (const auto& key_vector : sqrtHessianDiagonal)
+      damping.emplace(key_vector.first, lambda * key_vector.second.cwiseAbs2());
+    return damping;
+  }
 };
 
 }  // namespace internal
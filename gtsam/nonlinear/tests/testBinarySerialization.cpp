@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testBinarySerialization.cpp
+ * @brief Unit tests for the compact binary format
+ * @date Oct 2026
+ */
+
+#include <gtsam/nonlinear/BinarySerialization.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cstdio>
+#include <functional>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::X;
+using symbol_shorthand::L;
+
+/* ************************************************************************* */
+TEST(BinarySerialization, Values) {
+  Values values;
+  values.insert(X(0), Pose3(Rot3::RzRyRx(0.1, -0.2, 0.3), Point3(1, 2, 3)));
+  values.insert(X(1), Pose2(1, 2, 0.3));
+  values.insert(L(0), Point3(4, 5, 6));
+  values.insert(L(1), Point2(7, 8));
+  values.insert(2, Rot3::Ypr(0.3, 0.2, 0.1));
+  values.insert(3, Rot2::fromAngle(0.4));
+  values.insert(4, (Vector(4) << 1, 2, 3, 4).finished());
+  values.insert(5, 3.14);
+  values.insert(X(2), Pose3());
+
+  Values actual;
+  deserializeCompact(serializeCompact(values), actual);
+  EXPECT(assert_equal(values, actual));
+
+  // A type that is not registered can not be saved
+  Values unregistered;
+  unregistered.insert(0, Cal3_S2());
+  CHECK_EXCEPTION(serializeCompact(unregistered), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(BinarySerialization, VectorValues) {
+  VectorValues values;
+  values.insert(0, Vector3(1.0, 2.0, 3.0));
+  values.insert(7, Vector2(4.0, 5.0));
+  values.insert(3, (Vector(4) << 6.0, 7.0, 8.0, 9.0).finished());
+  values.insert(4, Vector());
+
+  VectorValues actual;
+  deserializeCompact(serializeCompact(values), actual);
+  EXPECT(assert_equal(values, actual));
+}
+
+/* ************************************************************************* */
+TEST(BinarySerialization, NonlinearFactorGraph) {
+  const SharedNoiseModel shared = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.2, 0.3));
+  Matrix33 R;
+  R << 1, 2, 3, 0, 4, 5, 0, 0, 6;
+  NonlinearFactorGraph graph;
+  graph.emplace_shared<PriorFactor<Pose2> >(0, Pose2(), shared);
+  graph.emplace_shared<BetweenFactor<Pose2> >(0, 1, Pose2(1, 0, 0.1), shared);
+  graph.emplace_shared<BetweenFactor<Pose2> >(1, 2, Pose2(1, 0, 0.1),
+      noiseModel::Gaussian::SqrtInformation(R));
+  graph.emplace_shared<BetweenFactor<Pose2> >(2, 0, Pose2(-2, 0, -0.2),
+      noiseModel::Robust::Create(noiseModel::mEstimator::Huber::Create(1.5), shared));
+  graph.push_back(NonlinearFactor::shared_ptr());
+  graph.emplace_shared<BetweenFactor<Pose3> >(3, 4, Pose3(Rot3::Ypr(0.1, 0.2, 0.3), Point3(1, 2, 3)),
+      noiseModel::Isotropic::Sigma(6, 0.5));
+  graph.emplace_shared<PriorFactor<Point3> >(5, Point3(1, 2, 3), noiseModel::Unit::Create(3));
+  graph.emplace_shared<PriorFactor<Vector> >(6, Vector2(1, 2),
+      noiseModel::Constrained::MixedSigmas(Vector2(0, 1)));
+  graph.emplace_shared<BetweenFactor<Rot3> >(7, 8, Rot3::Ypr(0.3, 0.2, 0.1),
+      noiseModel::Robust::Create(noiseModel::mEstimator::Tukey::Create(4.0),
+                                 noiseModel::Isotropic::Sigma(3, 0.1)));
+
+  NonlinearFactorGraph actual;
+  deserializeCompact(serializeCompact(graph), actual);
+  EXPECT(assert_equal(graph, actual));
+  EXPECT(!actual[4]);
+
+  // The shared noise model is written once, and still shared after reading
+  const auto factor0 = boost::dynamic_pointer_cast<PriorFactor<Pose2> >(actual[0]);
+  const auto factor1 = boost::dynamic_pointer_cast<BetweenFactor<Pose2> >(actual[1]);
+  const auto factor3 = boost::dynamic_pointer_cast<BetweenFactor<Pose2> >(actual[3]);
+  CHECK(factor0 && factor1 && factor3);
+  EXPECT(factor0->noiseModel() == factor1->noiseModel());
+  const auto robust = boost::dynamic_pointer_cast<noiseModel::Robust>(factor3->noiseModel());
+  CHECK(robust);
+  EXPECT(robust->noise() == factor0->noiseModel());
+}
+
+/* ************************************************************************* */
+TEST(BinarySerialization, File) {
+  NonlinearFactorGraph graph;
+  Values values;
+  const SharedNoiseModel model = noiseModel::Isotropic::Sigma(3, 0.1);
+  values.insert(0, Pose2());
+  for (size_t i = 1; i < 100; i++) {
+    graph.emplace_shared<BetweenFactor<Pose2> >(i - 1, i, Pose2(1, 0, 0.1), model);
+    values.insert(i, values.at<Pose2>(i - 1) * Pose2(1, 0, 0.1));
+  }
+
+  const string graphFile = "testBinarySerializationGraph.bin";
+  const string valuesFile = "testBinarySerializationValues.bin";
+  CHECK(serializeToCompactFile(graph, graphFile));
+  CHECK(serializeToCompactFile(values, valuesFile));
+  NonlinearFactorGraph actualGraph;
+  Values actualValues;
+  EXPECT(deserializeFromCompactFile(graphFile, actualGraph));
+  EXPECT(deserializeFromCompactFile(valuesFile, actualValues));
+  EXPECT(assert_equal(graph, actualGraph));
+  EXPECT(assert_equal(values, actualValues));
+
+  // Reading the wrong kind of object, or a missing file, fails
+  CHECK_EXCEPTION(deserializeFromCompactFile(valuesFile, actualGraph), std::runtime_error);
+  EXPECT(!deserializeFromCompactFile("missingBinarySerializationFile.bin", actualGraph));
+  remove(graphFile.c_str());
+  remove(valuesFile.c_str());
+}
+
+/* ************************************************************************* */
+TEST(BinarySerialization, Corrupt) {
+  Values values;
+  values.insert(0, Pose3());
+  const string serialized = serializeCompact(values);
+
+  Values actual;
+  CHECK_EXCEPTION(deserializeCompact(serialized.substr(0, serialized.size() - 1), actual),
+                  std::runtime_error);
+  string wrongVersion = serialized;
+  wrongVersion[8] = 99;
+  CHECK_EXCEPTION(deserializeCompact(wrongVersion, actual), std::runtime_error);
+
+  // The byte-order mark follows the version
+  string swapped = serialized;
+  std::swap(swapped[12], swapped[15]);
+  std::swap(swapped[13], swapped[14]);
+  CHECK_EXCEPTION(deserializeCompact(swapped, actual), std::runtime_error);
+}
+
+/* ************************************************************************* */
+namespace {
+// Write the header of an archive of a given kind (1 for Values, 3 for a graph)
+void writeHeader(uint32_t kind, BinaryWriter& writer) {
+  for (char c : string("GTSAMBIN"))
+    writer.write(c);
+  writer.write<uint32_t>(kCompactBinaryVersion);
+  writer.write<uint32_t>(0x01020304);
+  writer.write<uint32_t>(kind);
+}
+
+// An archive of a graph with one PriorFactor<Vector> on a 2-vector, with the noise model
+// written by writeNoiseModel
+string priorArchive(const std::function<void(BinaryWriter&)>& writeNoiseModel) {
+  BinaryWriter writer;
+  writeHeader(3, writer);
+  writer.write<uint64_t>(1);
+  writer.write<uint32_t>(0xFFFFFFFF);
+  writer.writeString("PriorFactor<Vector>");
+  writer.write<uint64_t>(X(0));
+  writer.writeVector(Vector2(1, 2));
+  writer.write<uint32_t>(0xFFFFFFFF);
+  writeNoiseModel(writer);
+  return writer.buffer();
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(BinarySerialization, CorruptSizes) {
+  NonlinearFactorGraph graph;
+
+  // A well-formed archive
+  deserializeCompact(priorArchive([](BinaryWriter& writer) {
+    writer.write<uint8_t>(5);  // unit
+    writer.write<uint64_t>(2);
+  }), graph);
+  LONGS_EQUAL(1, graph.size());
+
+  // Unit noise model of unbounded dimension
+  CHECK_EXCEPTION(deserializeCompact(priorArchive([](BinaryWriter& writer) {
+    writer.write<uint8_t>(5);
+    writer.write<uint64_t>(uint64_t(1) << 62);
+  }), graph), std::runtime_error);
+
+  // Constrained noise model with more weights than sigmas
+  CHECK_EXCEPTION(deserializeCompact(priorArchive([](BinaryWriter& writer) {
+    writer.write<uint8_t>(3);
+    writer.writeVector(Vector3(1, 1, 1));
+    writer.writeVector(Vector2(0, 1));
+  }), graph), std::runtime_error);
+
+  // Gaussian noise model with a non-square R
+  CHECK_EXCEPTION(deserializeCompact(priorArchive([](BinaryWriter& writer) {
+    writer.write<uint8_t>(1);
+    writer.writeMatrix(Matrix::Identity(2, 3));
+  }), graph), std::runtime_error);
+
+  // Robust noise model with an unknown reweight scheme
+  CHECK_EXCEPTION(deserializeCompact(priorArchive([](BinaryWriter& writer) {
+    writer.write<uint8_t>(6);
+    writer.write<uint8_t>(3);  // Huber
+    writer.write<uint8_t>(7);
+    writer.write<double>(1.345);
+    writer.write<uint32_t>(0xFFFFFFFF);
+    writer.write<uint8_t>(5);
+    writer.write<uint64_t>(2);
+  }), graph), std::runtime_error);
+
+  // More factors than could fit in the remaining bytes
+  BinaryWriter huge;
+  writeHeader(3, huge);
+  huge.write<uint64_t>(uint64_t(1) << 60);
+  CHECK_EXCEPTION(deserializeCompact(huge.buffer(), graph), std::runtime_error);
+}
+
+/* ************************************************************************* */
+TEST(BinarySerialization, DuplicateKey) {
+  BinaryWriter writer;
+  writeHeader(1, writer);
+  writer.write<uint64_t>(2);
+  writer.write<uint64_t>(X(0));
+  writer.write<uint32_t>(0xFFFFFFFF);
+  writer.writeString("double");
+  writer.write<double>(1.0);
+  writer.write<uint64_t>(X(0));
+  writer.write<uint32_t>(1);
+  writer.write<double>(2.0);
+
+  Values values;
+  CHECK_EXCEPTION(deserializeCompact(writer.buffer(), values), std::runtime_error);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
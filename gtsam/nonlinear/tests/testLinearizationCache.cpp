@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testLinearizationCache.cpp
+ * @brief Unit tests for LinearizationCache
+ * @date Oct 2026
+ */
+
+#include <gtsam/nonlinear/LinearizationCache.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/LinearContainerFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Point2.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+  const SharedDiagonal noise = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.2, 0.05));
+  const Key x0 = 0, x1 = 1, x2 = 2, l1 = 11;
+
+  // A chain of poses, plus a linear factor that linearizes to a HessianFactor
+  NonlinearFactorGraph Graph() {
+    NonlinearFactorGraph graph;
+    graph.addPrior(x0, Pose2(), noise);
+    graph += BetweenFactor<Pose2>(x0, x1, Pose2(1, 0, 0.3), noise);
+    graph += BetweenFactor<Pose2>(x1, x2, Pose2(1, 0.1, 0.2), noise);
+    Values landmark;
+    landmark.insert(l1, Point2(1, 2));
+    graph += LinearContainerFactor(
+        HessianFactor(l1, 4.0 * I_2x2, Vector2(1, -1), 2.0), landmark);
+    return graph;
+  }
+
+  Values Initial() {
+    Values values;
+    values.insert(x0, Pose2(0.1, 0.1, 0.1));
+    values.insert(x1, Pose2(1.2, 0.1, 0.4));
+    values.insert(x2, Pose2(2.1, 0.3, 0.5));
+    values.insert(l1, Point2(1.5, 2.5));
+    return values;
+  }
+
+  // Move each variable by a small amount
+  Values Moved(const Values& values, double step) {
+    VectorValues delta;
+    delta.insert(x0, Vector3(step, -step, step));
+    delta.insert(x1, Vector3(-step, step, step));
+    delta.insert(x2, Vector3(step, step, -step));
+    delta.insert(l1, Vector2(step, -step));
+    return values.retract(delta);
+  }
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, relinearizeAll) {
+  const NonlinearFactorGraph graph = Graph();
+  LinearizationCache cache(1e-9);
+
+  // With a tiny threshold, every factor is relinearized every time
+  Values values = Initial();
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT(assert_equal(*graph.linearize(values), *cache.linearize(graph, values)));
+    EXPECT_LONGS_EQUAL(graph.size(), cache.nrRelinearized());
+    values = Moved(values, 0.01);
+  }
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, reuse) {
+  const NonlinearFactorGraph graph = Graph();
+  LinearizationCache cache(0.1);
+
+  const Values values = Initial();
+  const GaussianFactorGraph::shared_ptr expected = graph.linearize(values);
+  EXPECT(assert_equal(*expected, *cache.linearize(graph, values)));
+  EXPECT_LONGS_EQUAL(graph.size(), cache.nrRelinearized());
+
+  // Nothing moved far enough, so the factors linearized at the original values are re-expressed
+  // in terms of an update of the moved values
+  const Values moved = Moved(values, 0.01);
+  const GaussianFactorGraph::shared_ptr actual = cache.linearize(graph, moved);
+  EXPECT_LONGS_EQUAL(0, cache.nrRelinearized());
+  EXPECT(assert_equal(values, cache.linearizationPoint()));
+  const VectorValues d = values.localCoordinates(moved);
+  VectorValues delta = VectorValues::Zero(d);
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t f = 0; f < graph.size(); ++f)
+      DOUBLES_EQUAL(expected->at(f)->error(d + delta), actual->at(f)->error(delta), 1e-9);
+    delta = delta + d;
+  }
+
+  // The linear factor is linear in the local coordinates, so it is still exact
+  EXPECT(assert_equal(*graph.back()->linearize(moved), *actual->back(), 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(LinearizationCache, partial) {
+  const NonlinearFactorGraph graph = Graph();
+  LinearizationCache cache(0.1);
+  const Values values = Initial();
+  cache.linearize(graph, values);
+
+  // Only the factors involving the variable that moved far are relinearized at its new value
+  Values moved = values;
+  moved.update(x2, Pose2(2.5, 0.3, 0.5));
+  const GaussianFactorGraph::shared_ptr actual = cache.linearize(graph, moved);
+  EXPECT_LONGS_EQUAL(1, cache.nrRelinearized());
+  EXPECT(assert_equal(*graph.at(2)->linearize(moved), *actual->at(2)));
+  EXPECT(assert_equal(moved, cache.linearizationPoint()));
+
+  // A different graph size clears the cache
+  NonlinearFactorGraph larger = graph;
+  larger += BetweenFactor<Pose2>(x0, x2, Pose2(2, 0, 0.5), noise);
+  EXPECT(assert_equal(*larger.linearize(moved), *cache.linearize(larger, moved)));
+  EXPECT_LONGS_EQUAL(larger.size(), cache.nrRelinearized());
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
+/* ************************************************************************* */
@@ -32,6 +32,7 @@ using namespace boost::assign;
 #include <stdexcept>
 #include <limits>
 #include <type_traits>
+#include <typeinfo>
 
 using namespace gtsam;
 using namespace std;
@@ -606,6 +607,128 @@ TEST(Values, Demangle) {
   EXPECT(assert_equal(expected, actual));
 }
 
+/* ************************************************************************* */
+TEST(Values, CopyAndAssign) {
+  Values values;
+  for (size_t i = 0; i < 100; ++i)
+    values.insert(i, Pose3(Rot3::Rz(0.01 * i), Point3(i, 0, 0)));
+  values.insert(Symbol('l', 1), Point3(1, 2, 3));
+
+  const Values copy(values);
+  EXPECT(assert_equal(values, copy));
+
+  Values assigned;
+  assigned.insert(key1, 5.0);
+  assigned = copy;
+  EXPECT(assert_equal(values, assigned));
+  assigned = *&assigned;
+  EXPECT(assert_equal(values, assigned));
+
+  VectorValues delta;
+  delta.insert(7, Vector6::Constant(0.1));
+  delta.insert(Symbol('l', 1), Vector3(1, 1, 1));
+  const Values retracted = values.retract(delta);
+  EXPECT_LONGS_EQUAL(values.size(), retracted.size());
+  EXPECT(assert_equal(values.at<Pose3>(6), retracted.at<Pose3>(6)));
+  EXPECT(assert_equal(values.at<Pose3>(7).retract(Vector6::Constant(0.1)),
+                      retracted.at<Pose3>(7)));
+  EXPECT(assert_equal(Point3(2, 3, 4), retracted.at<Point3>(Symbol('l', 1))));
+}
+
+/* ************************************************************************* */
+TEST(Values, RetractMixedTypes) {
+  // Variables of different types are interleaved, and some are not updated
+  Values values;
+  VectorValues delta;
+  for (size_t i = 0; i < 10; ++i) {
+    values.insert(4 * i, Pose2(i, 0, 0.1 * i));
+    values.insert(4 * i + 1, Point2(i, 1));
+    values.insert(4 * i + 2, (Vector(4) << i, 1, 2, 3).finished());
+    values.insert(4 * i + 3, 0.5 * i);
+    delta.insert(4 * i, Vector3(0.1, 0.2, 0.3 * i));
+    if (i % 2 == 0) delta.insert(4 * i + 1, Vector2(1, -1));
+    delta.insert(4 * i + 2, Vector4::Constant(i));
+    if (i % 3 == 0) delta.insert(4 * i + 3, Vector1(2.0));
+  }
+
+  const Values actual = values.retract(delta);
+  LONGS_EQUAL(values.size(), actual.size());
+  for (const Values::ConstKeyValuePair& key_value : values) {
+    VectorValues::const_iterator it = delta.find(key_value.key);
+    const Value& expected = *(it == delta.end() ? key_value.value.clone_()
+                                                : key_value.value.retract_(it->second));
+    EXPECT(expected.equals_(actual.at(key_value.key)));
+    EXPECT(typeid(expected) == typeid(actual.at(key_value.key)));
+    expected.deallocate_();
+  }
+}
+
+/* ************************************************************************* */
+TEST(Values, RetractLongRuns) {
+  // Runs of poses and points longer than a batch, broken by a variable that is not updated
+  Values values;
+  VectorValues delta;
+  for (size_t i = 0; i < 600; ++i) {
+    values.insert(Symbol('x', i), Pose3(Rot3::Ypr(0.01 * i, 0.2, -0.1), Point3(i, 0, 1)));
+    if (i != 300) delta.insert(Symbol('x', i), (Vector(6) << 0.1, -0.2, 0.3, 1, 2, 3).finished());
+  }
+  for (size_t j = 0; j < 300; ++j) {
+    values.insert(Symbol('l', j), Point3(j, 1, 2));
+    delta.insert(Symbol('l', j), Vector3(0.1, 0.2, 0.3 * j));
+  }
+
+  const Values actual = values.retract(delta);
+  LONGS_EQUAL(values.size(), actual.size());
+  for (const Values::ConstKeyValuePair& key_value : values) {
+    VectorValues::const_iterator it = delta.find(key_value.key);
+    const Value& expected = *(it == delta.end() ? key_value.value.clone_()
+                                                : key_value.value.retract_(it->second));
+    EXPECT(expected.equals_(actual.at(key_value.key), 1e-12));
+    expected.deallocate_();
+  }
+}
+
+/* ************************************************************************* */
+TEST(Values, RetractInPlace) {
+  Values values;
+  values.insert(0, Pose2(1, 2, 0.3));
+  values.insert(1, (Vector(4) << 1, 2, 3, 4).finished());
+  VectorValues delta;
+  delta.insert(0, Vector3(0.1, 0.2, 0.3));
+  delta.insert(1, Vector4::Constant(0.5));
+  const Values expected = values.retract(delta);
+
+  // The values are updated where they are stored
+  const Value* pose = &values.at(0);
+  values.find(0)->value.retractInPlace_(delta.at(0));
+  values.find(1)->value.retractInPlace_(delta.at(1));
+  EXPECT(assert_equal(expected, values));
+  EXPECT(pose == &values.at(0));
+}
+
+#ifdef GTSAM_VALUES_ARENA
+/* ************************************************************************* */
+TEST(Values, Arena) {
+  // Freed slots are handed out again
+  GenericValue<Pose3>* pose = new GenericValue<Pose3>(Pose3());
+  const void* address = pose;
+  pose->deallocate_();
+  Value* clone = GenericValue<Pose3>(Pose3()).clone_();
+  EXPECT(address == clone);
+  clone->deallocate_();
+
+  // Fixed-size vectorizable types stay aligned
+  Values values;
+  for (size_t i = 0; i < 200; ++i)
+    values.insert(i, Vector4(i, 0, 0, 0));
+  const Values copy(values);
+  for (size_t i = 0; i < 200; ++i) {
+    EXPECT_LONGS_EQUAL(0, reinterpret_cast<size_t>(copy.at<Vector4>(i).data()) % 16);
+    EXPECT_DOUBLES_EQUAL(double(i), copy.at<Vector4>(i).x(), 0.0);
+  }
+}
+#endif
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
 /* ************************************************************************* */
@@ -206,13 +206,11 @@ protected:
       boost::optional<Matrix&> E = boost::none) const {
     Vector ue = cameras.reprojectionError(point, measured_, Fs, E);
     if (body_P_sensor_ && Fs) {
-      const Pose3 sensor_P_body = body_P_sensor_->inverse();
-      for (size_t i = 0; i < Fs->size(); i++) {
-        const Pose3 w_Pose_body = cameras[i].pose() * sensor_P_body;
-        Matrix J(6, 6);
-        const Pose3 world_P_body = w_Pose_body.compose(*body_P_sensor_, J);
+      // Derivative of world_P_body * body_P_sensor with respect to world_P_body,
+      // which does not depend on the camera. Dynamic, as only D = 6 cameras use body_P_sensor.
+      const Matrix J = body_P_sensor_->inverse().AdjointMap();
+      for (size_t i = 0; i < Fs->size(); i++)
         Fs->at(i) = Fs->at(i) * J;
-      }
     }
     correctForMissingMeasurements(cameras, ue, Fs, E);
     return ue;
@@ -20,6 +20,16 @@
 #pragma once
 
 #include <gtsam/slam/SmartProjectionFactor.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/base/FastMap.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
 
 namespace gtsam {
 /**
@@ -166,4 +176,88 @@ struct traits<SmartProjectionPoseFactor<CALIBRATION> > : public Testable<
     SmartProjectionPoseFactor<CALIBRATION> > {
 };
 
+/**
+ * Linearize many SmartProjectionPoseFactors on the same Values at once, e.g. all landmarks
+ * tracked in a window of keyframes. The result is the same as calling linearize(values) on
+ * each factor, e.g. a RegularHessianFactor per factor in HESSIAN mode, in the same order.
+ *
+ * A keyframe is typically observed by hundreds of smart factors, and each of them would
+ * look up its pose and create its camera. Here, every camera is created once and shared by
+ * all factors that observe it and have the same calibration and body_P_sensor as the first
+ * factor; other factors create their own cameras. The factors are then triangulated and
+ * linearized, which includes their Schur complements, in parallel if GTSAM is built with
+ * TBB. As each factor caches its triangulation, factors must not appear twice.
+ */
+template<class CALIBRATION>
+GaussianFactorGraph::shared_ptr linearizeSmartFactors(
+    const std::vector<boost::shared_ptr<SmartProjectionPoseFactor<CALIBRATION> > >& factors,
+    const Values& values) {
+  typedef PinholePose<CALIBRATION> Camera;
+
+  GaussianFactorGraph::shared_ptr linearFG = boost::make_shared<GaussianFactorGraph>();
+  if (factors.empty())
+    return linearFG;
+
+  // Find the cameras of all factors that share the calibration and body_P_sensor
+  const boost::shared_ptr<CALIBRATION> K = factors.front()->calibration();
+  const Pose3 body_P_sensor = factors.front()->body_P_sensor();
+  std::vector<bool> shared(factors.size(), false);
+  FastMap<Key, size_t> cameraIndices;
+  KeyVector cameraKeys;
+  for (size_t j = 0; j < factors.size(); ++j) {
+    // Compare exactly, as Pose3::equals with zero tolerance is false for any translation
+    if (!factors[j] || factors[j]->calibration() != K
+        || factors[j]->body_P_sensor().matrix() != body_P_sensor.matrix())
+      continue;
+    shared[j] = true;
+    for (Key key : factors[j]->keys())
+      if (cameraIndices.emplace(key, cameraKeys.size()).second)
+        cameraKeys.push_back(key);
+  }
+
+  CameraSet<Camera> cameras;
+  cameras.resize(cameraKeys.size());
+  std::vector<GaussianFactor::shared_ptr> linearFactors(factors.size());
+  const auto createCamera = [&](size_t i) {
+    cameras[i] = Camera(values.at<Pose3>(cameraKeys[i]) * body_P_sensor, K);
+  };
+  const auto linearizeFactor = [&](size_t j) {
+    if (!factors[j])
+      return;
+    if (!shared[j]) {
+      linearFactors[j] = factors[j]->linearize(values);
+      return;
+    }
+    CameraSet<Camera> factorCameras;
+    factorCameras.reserve(factors[j]->size());
+    for (Key key : factors[j]->keys())
+      factorCameras.push_back(cameras[cameraIndices.at(key)]);
+    linearFactors[j] = factors[j]->linearizeDamped(factorCameras);
+  };
+
+#ifdef GTSAM_USE_TBB
+  TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, cameras.size()),
+      [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i != range.end(); ++i)
+          createCamera(i);
+      });
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, factors.size()),
+      [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t j = range.begin(); j != range.end(); ++j)
+          linearizeFactor(j);
+      });
+#else
+  for (size_t i = 0; i < cameras.size(); ++i)
+    createCamera(i);
+  for (size_t j = 0; j < factors.size(); ++j)
+    linearizeFactor(j);
+#endif
+
+  linearFG->reserve(factors.size());
+  for (const GaussianFactor::shared_ptr& factor : linearFactors)
+    linearFG->push_back(factor);
+  return linearFG;
+}
+
 } // \ namespace gtsam
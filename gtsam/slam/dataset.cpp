@@ -34,13 +34,29 @@
 #include <gtsam/base/Value.h>
 #include <gtsam/base/Vector.h>
 
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
 #include <boost/assign/list_inserter.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/lexical_cast.hpp>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <thread>
+#endif
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 
 using namespace std;
@@ -109,12 +125,31 @@ GraphAndValues load2D(pair<string, SharedNoiseModel> dataset, int maxID,
 }
 
 /* ************************************************************************* */
-// Read noise parameters and interpret them according to flags
-static SharedNoiseModel readNoiseModel(ifstream& is, bool smart,
-    NoiseFormat noiseFormat, KernelFunctionType kernelFunctionType) {
-  double v1, v2, v3, v4, v5, v6;
-  is >> v1 >> v2 >> v3 >> v4 >> v5 >> v6;
+// Wrap a noise model in a robust kernel, if asked
+static SharedNoiseModel robustNoiseModel(const SharedNoiseModel& model,
+    KernelFunctionType kernelFunctionType) {
+  switch (kernelFunctionType) {
+  case KernelFunctionTypeNONE:
+    return model;
+    break;
+  case KernelFunctionTypeHUBER:
+    return noiseModel::Robust::Create(
+        noiseModel::mEstimator::Huber::Create(1.345), model);
+    break;
+  case KernelFunctionTypeTUKEY:
+    return noiseModel::Robust::Create(
+        noiseModel::mEstimator::Tukey::Create(4.6851), model);
+    break;
+  default:
+    throw invalid_argument("gtsam: invalid kernel function type");
+  }
+}
 
+/* ************************************************************************* */
+// Interpret the six noise parameters of a 2D edge according to flags
+static SharedNoiseModel createNoiseModel(double v1, double v2, double v3, double v4,
+    double v5, double v6, bool smart, NoiseFormat noiseFormat,
+    KernelFunctionType kernelFunctionType) {
   if (noiseFormat == NoiseFormatAUTO) {
     // Try to guess covariance matrix layout
     if (v1 != 0.0 && v2 == 0.0 && v3 != 0.0 && v4 != 0.0 && v5 == 0.0
@@ -174,21 +209,17 @@ static SharedNoiseModel readNoiseModel(ifstream& is, bool smart,
     throw invalid_argument("load2D: invalid noise format");
   }
 
-  switch (kernelFunctionType) {
-  case KernelFunctionTypeNONE:
-    return model;
-    break;
-  case KernelFunctionTypeHUBER:
-    return noiseModel::Robust::Create(
-        noiseModel::mEstimator::Huber::Create(1.345), model);
-    break;
-  case KernelFunctionTypeTUKEY:
-    return noiseModel::Robust::Create(
-        noiseModel::mEstimator::Tukey::Create(4.6851), model);
-    break;
-  default:
-    throw invalid_argument("load2D: invalid kernel function type");
-  }
+  return robustNoiseModel(model, kernelFunctionType);
+}
+
+/* ************************************************************************* */
+// Read noise parameters and interpret them according to flags
+static SharedNoiseModel readNoiseModel(ifstream& is, bool smart,
+    NoiseFormat noiseFormat, KernelFunctionType kernelFunctionType) {
+  double v1, v2, v3, v4, v5, v6;
+  is >> v1 >> v2 >> v3 >> v4 >> v5 >> v6;
+  return createNoiseModel(v1, v2, v3, v4, v5, v6, smart, noiseFormat,
+      kernelFunctionType);
 }
 
 /* ************************************************************************* */
@@ -408,19 +439,366 @@ void save2D(const NonlinearFactorGraph& graph, const Values& config,
   stream.close();
 }
 
+/* ************************************************************************* */
+namespace {
+
+// Lines of a memory-mapped file are parsed in place, with a hand-rolled number parser, since
+// istream extraction is the bottleneck when loading large files.
+class G2oLineParser {
+  const char* p_;
+  const char* end_;
+
+  void skipSpaces() {
+    while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\r'))
+      ++p_;
+  }
+
+  static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+public:
+  G2oLineParser(const char* begin, const char* end) : p_(begin), end_(end) {}
+
+  bool atEnd() const { return p_ == end_; }
+
+  /// Advance to the start of the next line
+  void nextLine() {
+    const void* newline = memchr(p_, '\n', end_ - p_);
+    p_ = newline ? static_cast<const char*>(newline) + 1 : end_;
+  }
+
+  /// Return the start of the next line, without changing the state
+  static const char* NextLine(const char* p, const char* end) {
+    G2oLineParser parser(p, end);
+    parser.nextLine();
+    return parser.p_;
+  }
+
+  /// Read the tag at the start of the line, returns false for an empty line
+  bool tag(const char*& begin, const char*& end) {
+    skipSpaces();
+    begin = p_;
+    while (p_ != end_ && *p_ != ' ' && *p_ != '\t' && *p_ != '\r' && *p_ != '\n')
+      ++p_;
+    end = p_;
+    return begin != end;
+  }
+
+  /// Fails for keys that do not fit in a Key
+  bool parse(Key& key) {
+    skipSpaces();
+    if (p_ == end_ || !isDigit(*p_))
+      return false;
+    const Key max = std::numeric_limits<Key>::max();
+    key = 0;
+    while (p_ != end_ && isDigit(*p_)) {
+      const Key digit = *p_++ - '0';
+      if (key > (max - digit) / 10)
+        return false;
+      key = 10 * key + digit;
+    }
+    return true;
+  }
+
+  bool parse(double& x) {
+    skipSpaces();
+    const char* start = p_;
+    bool negative = false;
+    if (p_ != end_ && (*p_ == '-' || *p_ == '+'))
+      negative = (*p_++ == '-');
+
+    // Accumulate up to 19 significant digits in an integer mantissa
+    uint64_t mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool truncated = false, anyDigits = false;
+    auto addDigit = [&](char c) {
+      if (digits < 19) {
+        mantissa = 10 * mantissa + (c - '0');
+        if (mantissa) ++digits;
+        return true;
+      }
+      truncated |= (c != '0');
+      return false;
+    };
+    for (; p_ != end_ && isDigit(*p_); ++p_, anyDigits = true)
+      if (!addDigit(*p_)) ++exponent;
+    if (p_ != end_ && *p_ == '.') {
+      for (++p_; p_ != end_ && isDigit(*p_); ++p_, anyDigits = true)
+        if (addDigit(*p_)) --exponent;
+    }
+    if (!anyDigits) {
+      p_ = start;
+      return false;
+    }
+    if (p_ != end_ && (*p_ == 'e' || *p_ == 'E')) {
+      ++p_;
+      bool negativeExponent = false;
+      if (p_ != end_ && (*p_ == '-' || *p_ == '+'))
+        negativeExponent = (*p_++ == '-');
+      if (p_ == end_ || !isDigit(*p_)) {
+        p_ = start;
+        return false;
+      }
+      int e = 0;
+      for (; p_ != end_ && isDigit(*p_); ++p_)
+        if (e < 10000) e = 10 * e + (*p_ - '0');
+      exponent += negativeExponent ? -e : e;
+    }
+
+    // Mantissas below 2^53 and powers of ten up to 1e22 are exact doubles, so a single
+    // multiplication or division is correctly rounded. Otherwise, defer to strtod.
+    static const double kPowersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    if (!truncated && mantissa < (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+      x = double(mantissa);
+      x = exponent < 0 ? x / kPowersOfTen[-exponent] : x * kPowersOfTen[exponent];
+      if (negative) x = -x;
+    } else {
+      // The mapped file is not null-terminated, so copy the number
+      x = strtod(string(start, p_).c_str(), nullptr);
+    }
+    return true;
+  }
+
+  template <typename T, typename... Ts>
+  bool parse(T& first, Ts&... rest) {
+    return parse(first) && parse(rest...);
+  }
+};
+
+bool tagIs(const char* begin, const char* end, const char* tag) {
+  const size_t n = end - begin;
+  return strlen(tag) == n && strncmp(begin, tag, n) == 0;
+}
+
+// The factors and poses parsed from one batch of lines, keeping the first of repeated vertices
+struct G2oBatch {
+  NonlinearFactorGraph graph;
+  Values initial;
+  bool ignoredLandmarkCovariance = false;  ///< as load2D, warned about once per file
+};
+
+// Parse the lines in [begin, end), of which the first is line number firstLine
+void parseG2oBatch(const char* begin, const char* end, size_t firstLine, bool is3D,
+    KernelFunctionType kernelFunctionType, G2oBatch& batch) {
+  G2oLineParser line(begin, end);
+  for (size_t lineNumber = firstLine; !line.atEnd(); ++lineNumber, line.nextLine()) {
+    const char *tagBegin, *tagEnd;
+    if (!line.tag(tagBegin, tagEnd))
+      continue;
+    bool ok = true;
+    if (!is3D) {
+      if (tagIs(tagBegin, tagEnd, "VERTEX_SE2") || tagIs(tagBegin, tagEnd, "VERTEX2")
+          || tagIs(tagBegin, tagEnd, "VERTEX")) {
+        Key id;
+        double x, y, yaw;
+        if ((ok = line.parse(id, x, y, yaw)) && !batch.initial.exists(id))
+          batch.initial.insert(id, Pose2(x, y, yaw));
+      } else if (tagIs(tagBegin, tagEnd, "EDGE_SE2") || tagIs(tagBegin, tagEnd, "EDGE2")
+          || tagIs(tagBegin, tagEnd, "EDGE") || tagIs(tagBegin, tagEnd, "ODOMETRY")) {
+        Key id1, id2;
+        double x, y, yaw, v1, v2, v3, v4, v5, v6;
+        if ((ok = line.parse(id1, id2, x, y, yaw, v1, v2, v3, v4, v5, v6))) {
+          // Information matrix in g2o order, with the same model as load2D
+          batch.graph.emplace_shared<BetweenFactor<Pose2> >(id1, id2, Pose2(x, y, yaw),
+              createNoiseModel(v1, v2, v3, v4, v5, v6, true, NoiseFormatG2O,
+                  kernelFunctionType));
+        }
+      } else if (tagIs(tagBegin, tagEnd, "BR") || tagIs(tagBegin, tagEnd, "LANDMARK")) {
+        // Bearing-range measurements, converted as in load2D
+        Key id1, id2;
+        double bearing, range, bearing_std, range_std;
+        if (tagEnd - tagBegin == 2) {
+          ok = line.parse(id1, id2, bearing, range, bearing_std, range_std);
+        } else {
+          double lmx, lmy, v1, v2, v3;
+          if ((ok = line.parse(id1, id2, lmx, lmy, v1, v2, v3))) {
+            bearing = atan2(lmy, lmx);
+            range = sqrt(lmx * lmx + lmy * lmy);
+            if (std::abs(v1 - v3) < 1e-4) {
+              bearing_std = sqrt(v1 / 10.0);
+              range_std = sqrt(v1);
+            } else {
+              bearing_std = 1;
+              range_std = 1;
+              batch.ignoredLandmarkCovariance = true;
+            }
+          }
+        }
+        if (ok)
+          batch.graph.emplace_shared<BearingRangeFactor<Pose2, Point2> >(id1, L(id2),
+              bearing, range,
+              noiseModel::Diagonal::Sigmas((Vector(2) << bearing_std, range_std).finished()));
+      }
+    } else {
+      if (tagIs(tagBegin, tagEnd, "VERTEX_SE3:QUAT")) {
+        Key id;
+        double x, y, z, qx, qy, qz, qw;
+        if ((ok = line.parse(id, x, y, z, qx, qy, qz, qw)) && !batch.initial.exists(id))
+          batch.initial.insert(id, Pose3(Rot3::Quaternion(qw, qx, qy, qz), {x, y, z}));
+      } else if (tagIs(tagBegin, tagEnd, "VERTEX3")) {
+        Key id;
+        double x, y, z, roll, pitch, yaw;
+        if ((ok = line.parse(id, x, y, z, roll, pitch, yaw)) && !batch.initial.exists(id))
+          batch.initial.insert(id, Pose3(Rot3::Ypr(yaw, pitch, roll), {x, y, z}));
+      } else if (tagIs(tagBegin, tagEnd, "EDGE_SE3:QUAT") || tagIs(tagBegin, tagEnd, "EDGE3")) {
+        const bool quaternion = (tagEnd - tagBegin == 13);
+        Key id1, id2;
+        double x, y, z, r1, r2, r3, r4 = 0.0;
+        ok = quaternion ? line.parse(id1, id2, x, y, z, r1, r2, r3, r4)
+                        : line.parse(id1, id2, x, y, z, r1, r2, r3);
+        Matrix6 m;
+        for (size_t i = 0; ok && i < 6; i++) {
+          for (size_t j = i; ok && j < 6; j++) {
+            ok = line.parse(m(i, j));
+            m(j, i) = m(i, j);
+          }
+        }
+        if (ok) {
+          Pose3 measured;
+          Matrix6 information = m;
+          if (quaternion) {
+            measured = Pose3(Rot3::Quaternion(r4, r1, r2, r3), {x, y, z});
+            // Same block order as parse3DFactors
+            information.block<3, 3>(0, 0) = m.block<3, 3>(3, 3);  // cov rotation
+            information.block<3, 3>(3, 3) = m.block<3, 3>(0, 0);  // cov translation
+          } else {
+            measured = Pose3(Rot3::Ypr(r3, r2, r1), {x, y, z});
+          }
+          batch.graph.emplace_shared<BetweenFactor<Pose3> >(id1, id2, measured,
+              robustNoiseModel(noiseModel::Gaussian::Information(information),
+                  kernelFunctionType));
+        }
+      }
+    }
+    if (!ok)
+      throw invalid_argument("streamG2o: could not parse line "
+          + boost::lexical_cast<string>(lineNumber + 1) + " starting with "
+          + string(tagBegin, tagEnd));
+  }
+}
+
+#ifdef GTSAM_USE_TBB
+class _ParseG2oBatches {
+  const vector<const char*>& bounds_;
+  size_t firstLine_, batchSize_;
+  bool is3D_;
+  KernelFunctionType kernelFunctionType_;
+  vector<G2oBatch>& batches_;
+public:
+  _ParseG2oBatches(const vector<const char*>& bounds, size_t firstLine, size_t batchSize,
+      bool is3D, KernelFunctionType kernelFunctionType, vector<G2oBatch>& batches) :
+      bounds_(bounds), firstLine_(firstLine), batchSize_(batchSize), is3D_(is3D),
+      kernelFunctionType_(kernelFunctionType), batches_(batches) {
+  }
+  void operator()(const tbb::blocked_range<size_t>& blocked_range) const {
+    for (size_t b = blocked_range.begin(); b != blocked_range.end(); ++b)
+      parseG2oBatch(bounds_[b], bounds_[b + 1], firstLine_ + b * batchSize_, is3D_,
+          kernelFunctionType_, batches_[b]);
+  }
+};
+#endif
+
+// Build the whole graph with streamG2o
+GraphAndValues loadG2o(const string& filename, bool is3D,
+    KernelFunctionType kernelFunctionType) {
+  NonlinearFactorGraph::shared_ptr graph(new NonlinearFactorGraph);
+  Values::shared_ptr initial(new Values);
+  streamG2o(filename, [&](const NonlinearFactorGraph& factors, const Values& poses) {
+    graph->push_back(factors);
+    // The first of repeated vertices wins, also across batches
+    for (const auto& key_value : poses)
+      initial->tryInsert(key_value.key, key_value.value);
+  }, is3D, kernelFunctionType);
+
+  // As load2D, initialize the poses and landmarks that have no vertex from the measurements,
+  // in file order, starting at the origin
+  if (!is3D) {
+    for (const auto& factor : *graph) {
+      if (auto between = boost::dynamic_pointer_cast<BetweenFactor<Pose2> >(factor)) {
+        const Key id1 = between->key1(), id2 = between->key2();
+        if (!initial->exists(id1))
+          initial->insert(id1, Pose2());
+        if (!initial->exists(id2))
+          initial->insert(id2, initial->at<Pose2>(id1) * between->measured());
+      } else if (auto bearingRange =
+          boost::dynamic_pointer_cast<BearingRangeFactor<Pose2, Point2> >(factor)) {
+        const Key id1 = bearingRange->keys()[0], id2 = bearingRange->keys()[1];
+        if (!initial->exists(id1))
+          initial->insert(id1, Pose2());
+        if (!initial->exists(id2)) {
+          const Rot2 bearing = bearingRange->measured().bearing();
+          const double range = bearingRange->measured().range();
+          const Point2 local(bearing.c() * range, bearing.s() * range);
+          initial->insert(id2, initial->at<Pose2>(id1).transformFrom(local));
+        }
+      }
+    }
+  }
+  return make_pair(graph, initial);
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+void streamG2o(const string& filename, const G2oBatchCallback& callback, bool is3D,
+    KernelFunctionType kernelFunctionType, size_t batchSize) {
+  if (!fs::is_regular_file(filename))
+    throw invalid_argument("streamG2o: can not find file " + filename);
+  if (batchSize == 0)
+    throw invalid_argument("streamG2o: batchSize must be positive");
+  if (fs::file_size(filename) == 0)
+    return; // an empty file can not be mapped
+
+  namespace ip = boost::interprocess;
+  ip::file_mapping file(filename.c_str(), ip::read_only);
+  ip::mapped_region region(file, ip::read_only);
+  const char* p = static_cast<const char*>(region.get_address());
+  const char* const end = p + region.get_size();
+
+  // Parse as many batches at a time as there are threads, then call back in order
+#ifdef GTSAM_USE_TBB
+  const size_t window = std::max(1u, std::thread::hardware_concurrency());
+#else
+  const size_t window = 1;
+#endif
+  vector<const char*> bounds;
+  vector<G2oBatch> batches;
+  size_t firstLine = 0;
+  bool warnedLandmarkCovariance = false;
+  while (p != end) {
+    bounds.assign(1, p);
+    while (p != end && bounds.size() <= window) {
+      for (size_t n = 0; n < batchSize && p != end; ++n)
+        p = G2oLineParser::NextLine(p, end);
+      bounds.push_back(p);
+    }
+    const size_t nrBatches = bounds.size() - 1;
+    batches.clear();
+    batches.resize(nrBatches);
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, nrBatches, 1),
+        _ParseG2oBatches(bounds, firstLine, batchSize, is3D, kernelFunctionType, batches));
+#else
+    for (size_t b = 0; b < nrBatches; ++b)
+      parseG2oBatch(bounds[b], bounds[b + 1], firstLine + b * batchSize, is3D,
+          kernelFunctionType, batches[b]);
+#endif
+    for (const G2oBatch& batch : batches) {
+      if (batch.ignoredLandmarkCovariance && !warnedLandmarkCovariance) {
+        cout << "Warning: streamG2o is ignoring the non-uniform covariance on LANDMARK\n"
+                "measurements in this file." << endl;
+        warnedLandmarkCovariance = true;
+      }
+      callback(batch.graph, batch.initial);
+    }
+    firstLine += nrBatches * batchSize;
+  }
+}
+
 /* ************************************************************************* */
 GraphAndValues readG2o(const string& g2oFile, const bool is3D,
                        KernelFunctionType kernelFunctionType) {
-  if (is3D) {
-    return load3D(g2oFile);
-  } else {
-    // just call load2D
-    int maxID = 0;
-    bool addNoise = false;
-    bool smart = true;
-    return load2D(g2oFile, SharedNoiseModel(), maxID, addNoise, smart,
-                  NoiseFormatG2O, kernelFunctionType);
-  }
+  return loadG2o(g2oFile, is3D, kernelFunctionType);
 }
 
 /* ************************************************************************* */
@@ -594,19 +972,7 @@ BetweenFactorPose3s parse3DFactors(const string& filename) {
 
 /* ************************************************************************* */
 GraphAndValues load3D(const string& filename) {
-  const auto factors = parse3DFactors(filename);
-  NonlinearFactorGraph::shared_ptr graph(new NonlinearFactorGraph);
-  for (const auto& factor : factors) {
-    graph->push_back(factor);
-  }
-
-  const auto poses = parse3DPoses(filename);
-  Values::shared_ptr initial(new Values);
-  for (const auto& key_pose : poses) {
-    initial->insert(key_pose.first, key_pose.second);
-  }
-
-  return make_pair(graph, initial);
+  return loadG2o(filename, true, KernelFunctionTypeNONE);
 }
 
 /* ************************************************************************* */
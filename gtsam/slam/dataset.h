@@ -33,6 +33,7 @@
 #include <gtsam/base/types.h>
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <functional>
 #include <string>
 #include <utility> // for pair
 #include <vector>
@@ -138,7 +139,8 @@ GTSAM_EXPORT void save2D(const NonlinearFactorGraph& graph,
 
 /**
  * @brief This function parses a g2o file and stores the measurements into a
- * NonlinearFactorGraph and the initial guess in a Values structure
+ * NonlinearFactorGraph and the initial guess in a Values structure. If a vertex
+ * is repeated, the first one is kept.
  * @param filename The name of the g2o file\
  * @param is3D indicates if the file describes a 2D or 3D problem
  * @param kernelFunctionType whether to wrap the noise model in a robust kernel
@@ -167,6 +169,30 @@ GTSAM_EXPORT std::map<Key, Pose3> parse3DPoses(const std::string& filename);
 /// Load TORO 3D Graph
 GTSAM_EXPORT GraphAndValues load3D(const std::string& filename);
 
+/// Callback for streamG2o, given the factors for the edges and the poses for the vertices in a batch
+typedef std::function<void(const NonlinearFactorGraph&, const Values&)> G2oBatchCallback;
+
+/**
+ * @brief Parse a g2o or TORO pose graph file in batches of lines, without reading the whole
+ * file into memory or building the whole graph.
+ * The file is memory-mapped and parsed in place. With TBB, several batches are parsed in
+ * parallel, but the callback is always called from the calling thread, in file order.
+ * In 2D, VERTEX_SE2/VERTEX2/VERTEX and EDGE_SE2/EDGE2/EDGE/ODOMETRY lines are parsed, with the
+ * information matrix in g2o order, and BR/LANDMARK lines as bearing-range factors, all as in
+ * load2D with NoiseFormatG2O. In 3D, VERTEX_SE3:QUAT/VERTEX3 and EDGE_SE3:QUAT/EDGE3 lines are
+ * parsed as in load3D. All other lines are skipped, and lines with keys too large for a Key
+ * are an error. If a vertex is repeated within a batch, the first one is kept, as in
+ * parse3DPoses. Unlike readG2o, no poses are created for vertices that only appear in edges.
+ * @param filename The name of the g2o file
+ * @param callback called once for every batch
+ * @param is3D indicates if the file describes a 2D or 3D problem
+ * @param kernelFunctionType whether to wrap the noise model in a robust kernel
+ * @param batchSize the number of lines in a batch
+ */
+GTSAM_EXPORT void streamG2o(const std::string& filename, const G2oBatchCallback& callback,
+    bool is3D = false, KernelFunctionType kernelFunctionType = KernelFunctionTypeNONE,
+    size_t batchSize = 100000);
+
 /// A measurement with its camera index
 typedef std::pair<size_t, Point2> SfmMeasurement;
 
@@ -23,9 +23,11 @@
 #include <gtsam/base/TestableAssertions.h>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
 
 #include <CppUnitLite/TestHarness.h>
 
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -232,6 +234,129 @@ TEST(dataSet, readG2o3D) {
   }
 }
 
+/* ************************************************************************* */
+TEST(dataSet, streamG2o) {
+  // 2D, in batches of 5 lines
+  const string g2oFile = findExampleDataFile("pose2example");
+  NonlinearFactorGraph::shared_ptr expectedGraph;
+  Values::shared_ptr expectedValues;
+  boost::tie(expectedGraph, expectedValues) = readG2o(g2oFile);
+
+  NonlinearFactorGraph actualGraph;
+  Values actualValues;
+  size_t nrBatches = 0;
+  streamG2o(g2oFile, [&](const NonlinearFactorGraph& graph, const Values& values) {
+    EXPECT(graph.size() + values.size() <= 5);
+    actualGraph.push_back(graph);
+    actualValues.insert(values);
+    ++nrBatches;
+  }, false, KernelFunctionTypeNONE, 5);
+  EXPECT_LONGS_EQUAL(5, nrBatches);  // 23 lines
+  EXPECT(assert_equal(*expectedGraph, actualGraph, 1e-9));
+  EXPECT(assert_equal(*expectedValues, actualValues, 1e-9));
+
+  // 3D, in one batch
+  const string g2oFile3D = findExampleDataFile("pose3example");
+  const auto expectedFactors = parse3DFactors(g2oFile3D);
+  const auto expectedPoses = parse3DPoses(g2oFile3D);
+  NonlinearFactorGraph actualGraph3D;
+  Values actualValues3D;
+  streamG2o(g2oFile3D, [&](const NonlinearFactorGraph& graph, const Values& values) {
+    actualGraph3D.push_back(graph);
+    actualValues3D.insert(values);
+  }, true);
+  LONGS_EQUAL(expectedFactors.size(), actualGraph3D.size());
+  for (size_t i = 0; i < expectedFactors.size(); i++)
+    EXPECT(assert_equal(*expectedFactors[i],
+        *boost::dynamic_pointer_cast<BetweenFactor<Pose3>>(actualGraph3D[i]), 1e-9));
+  LONGS_EQUAL(expectedPoses.size(), actualValues3D.size());
+  for (const auto& key_pose : expectedPoses)
+    EXPECT(assert_equal(key_pose.second, actualValues3D.at<Pose3>(key_pose.first), 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(dataSet, readG2o2DAsLoad2D) {
+  // readG2o streams 2D files, with the same factors, noise models and poses as load2D
+  for (const string name : {"pose2example", "noisyToyGraph"}) {
+    const string g2oFile = findExampleDataFile(name);
+    NonlinearFactorGraph::shared_ptr expectedGraph, actualGraph;
+    Values::shared_ptr expectedValues, actualValues;
+    boost::tie(expectedGraph, expectedValues) =
+        load2D(g2oFile, SharedNoiseModel(), 0, false, true, NoiseFormatG2O);
+    boost::tie(actualGraph, actualValues) = readG2o(g2oFile);
+    EXPECT(assert_equal(*expectedGraph, *actualGraph, 1e-9));
+    EXPECT(assert_equal(*expectedValues, *actualValues, 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+TEST(dataSet, readG2o2DOdometryAndLandmarks) {
+  // Poses without a vertex, and landmarks, are initialized from the measurements as in load2D
+  const string filename =
+      (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+  {
+    ofstream os(filename.c_str());
+    os << "EDGE_SE2 0 1 1 0 0.5 10 0 0 10 0 20\n"
+          "EDGE_SE2 1 2 1 0 0.5 10 0 0 10 0 20\n"
+          "BR 1 7 0.3 2 0.1 0.2\n"
+          "LANDMARK 2 8 1 1 0.5 0 0.5\n";
+  }
+  NonlinearFactorGraph::shared_ptr expectedGraph, actualGraph;
+  Values::shared_ptr expectedValues, actualValues;
+  boost::tie(expectedGraph, expectedValues) =
+      load2D(filename, SharedNoiseModel(), 0, false, true, NoiseFormatG2O);
+  boost::tie(actualGraph, actualValues) = readG2o(filename);
+  boost::filesystem::remove(filename);
+  LONGS_EQUAL(4, actualGraph->size());
+  LONGS_EQUAL(5, actualValues->size());
+  EXPECT(assert_equal(*expectedGraph, *actualGraph, 1e-9));
+  EXPECT(assert_equal(*expectedValues, *actualValues, 1e-9));
+}
+
+/* ************************************************************************* */
+namespace {
+// A file in the temporary directory, removed when it goes out of scope
+struct TemporaryFile {
+  const string filename;
+  explicit TemporaryFile(const string& contents)
+      : filename((boost::filesystem::temp_directory_path() /
+                  boost::filesystem::unique_path()).string()) {
+    ofstream os(filename.c_str());
+    os << contents;
+  }
+  ~TemporaryFile() { boost::filesystem::remove(filename); }
+};
+}
+
+TEST(dataSet, readG2oKeyOverflow) {
+  const TemporaryFile file("VERTEX_SE2 18446744073709551615 0 0 0\n"
+                           "VERTEX_SE2 18446744073709551616 0 0 0\n");
+  CHECK_EXCEPTION(readG2o(file.filename), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(dataSet, readG2oRepeatedVertex) {
+  // The first vertex is kept, whether the repeat is in the same batch or a later one
+  const TemporaryFile file("VERTEX_SE2 0 1 2 0.3\n"
+                           "VERTEX_SE2 1 0 0 0\n"
+                           "VERTEX_SE2 0 4 5 0.6\n"
+                           "EDGE_SE2 0 1 1 0 0 1 0 0 1 0 1\n"
+                           "VERTEX_SE2 0 7 8 0.9\n");
+  Values expected;
+  expected.insert(0, Pose2(1, 2, 0.3));
+  expected.insert(1, Pose2());
+  EXPECT(assert_equal(expected, *readG2o(file.filename).second));
+
+  for (const size_t batchSize : {1, 2, 3, 100}) {
+    Values actual;
+    streamG2o(file.filename, [&](const NonlinearFactorGraph&, const Values& values) {
+      for (const auto& key_value : values)
+        actual.tryInsert(key_value.key, key_value.value);
+    }, false, KernelFunctionTypeNONE, batchSize);
+    EXPECT(assert_equal(expected, actual));
+  }
+}
+
 /* ************************************************************************* */
 TEST( dataSet, readG2o3DNonDiagonalNoise)
 {
@@ -1331,6 +1331,88 @@ TEST( SmartProjectionPoseFactor, Cal3BundlerRotationOnly ) {
           values.at<Pose3>(x3)));
 }
 
+/* ************************************************************************* */
+TEST( SmartProjectionPoseFactor, linearizeSmartFactors ) {
+  using namespace vanillaPose;
+
+  Point2Vector measurements_cam1, measurements_cam2, measurements_cam3;
+  projectToMultipleCameras(cam1, cam2, cam3, landmark1, measurements_cam1);
+  projectToMultipleCameras(cam1, cam2, cam3, landmark2, measurements_cam2);
+  projectToMultipleCameras(cam1, cam2, cam3, landmark3, measurements_cam3);
+  KeyVector views {x1, x2, x3};
+
+  // The last factor has another body_P_sensor, so does not share the cameras
+  const Pose3 body_P_sensor(Rot3::Ypr(-0.1, 0.2, -0.2), Point3(0.1, 0.0, 0.0));
+  vector<SmartFactor::shared_ptr> factors, expectedFactors;
+  for (size_t copy = 0; copy < 2; copy++) {
+    vector<SmartFactor::shared_ptr>& f = copy ? expectedFactors : factors;
+    f.push_back(boost::make_shared<SmartFactor>(model, sharedK));
+    f.back()->add(measurements_cam1, views);
+    f.push_back(boost::make_shared<SmartFactor>(model, sharedK));
+    f.back()->add(measurements_cam2, views);
+    f.push_back(boost::make_shared<SmartFactor>(model, sharedK, body_P_sensor));
+    f.back()->add(measurements_cam3, views);
+  }
+
+  Values values;
+  values.insert(x1, cam1.pose());
+  values.insert(x2, cam2.pose() * Pose3(Rot3::Ypr(0.01, -0.02, 0.01), Point3(0.05, 0.1, -0.1)));
+  values.insert(x3, cam3.pose() * Pose3(Rot3::Ypr(-0.02, 0.01, 0.02), Point3(-0.1, 0.1, 0.1)));
+
+  GaussianFactorGraph::shared_ptr actual = linearizeSmartFactors(factors, values);
+  LONGS_EQUAL(3, actual->size());
+  for (size_t j = 0; j < 3; j++) {
+    GaussianFactor::shared_ptr expected = expectedFactors[j]->linearize(values);
+    EXPECT(boost::dynamic_pointer_cast<RegularHessianFactor<6> >(actual->at(j)));
+    EXPECT(assert_equal(expected->augmentedInformation(), actual->at(j)->augmentedInformation(), 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+TEST( SmartProjectionPoseFactor, linearizeSmartFactorsBodyPSensor ) {
+  using namespace vanillaPose;
+
+  Point2Vector measurements_cam1, measurements_cam2, measurements_cam3;
+  projectToMultipleCameras(cam1, cam2, cam3, landmark1, measurements_cam1);
+  projectToMultipleCameras(cam1, cam2, cam3, landmark2, measurements_cam2);
+  projectToMultipleCameras(cam1, cam2, cam3, landmark3, measurements_cam3);
+  KeyVector views {x1, x2, x3};
+
+  // The first two factors share the cameras, which include body_P_sensor, the last does not
+  const Pose3 body_P_sensor(Rot3::Ypr(-0.1, 0.2, -0.2), Point3(0.1, 0.0, 0.0));
+  vector<SmartFactor::shared_ptr> factors, expectedFactors;
+  for (size_t copy = 0; copy < 2; copy++) {
+    vector<SmartFactor::shared_ptr>& f = copy ? expectedFactors : factors;
+    f.push_back(boost::make_shared<SmartFactor>(model, sharedK, body_P_sensor));
+    f.back()->add(measurements_cam1, views);
+    f.push_back(boost::make_shared<SmartFactor>(model, sharedK, body_P_sensor));
+    f.back()->add(measurements_cam2, views);
+    f.push_back(boost::make_shared<SmartFactor>(model, sharedK));
+    f.back()->add(measurements_cam3, views);
+  }
+
+  // Poses of the body, such that the sensor is close to the cameras the landmarks were seen by
+  const Pose3 sensor_P_body = body_P_sensor.inverse();
+  Values values;
+  values.insert(x1, cam1.pose() * sensor_P_body);
+  values.insert(x2, cam2.pose() * Pose3(Rot3::Ypr(0.01, -0.02, 0.01), Point3(0.05, 0.1, -0.1))
+                        * sensor_P_body);
+  values.insert(x3, cam3.pose() * Pose3(Rot3::Ypr(-0.02, 0.01, 0.02), Point3(-0.1, 0.1, 0.1))
+                        * sensor_P_body);
+
+  GaussianFactorGraph::shared_ptr actual = linearizeSmartFactors(factors, values);
+  LONGS_EQUAL(3, actual->size());
+  for (size_t j = 0; j < 3; j++) {
+    GaussianFactor::shared_ptr expected = expectedFactors[j]->linearize(values);
+    EXPECT(boost::dynamic_pointer_cast<RegularHessianFactor<6> >(actual->at(j)));
+    EXPECT(assert_equal(expected->augmentedInformation(), actual->at(j)->augmentedInformation(), 1e-9));
+  }
+
+  // The shared cameras are those of the sensor, so the factors triangulate the same point
+  EXPECT(factors[0]->point());
+  EXPECT(assert_equal(*expectedFactors[0]->point(), *factors[0]->point(), 1e-9));
+}
+
 /* ************************************************************************* */
 BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Constrained, "gtsam_noiseModel_Constrained");
 BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Diagonal, "gtsam_noiseModel_Diagonal");
@@ -46,6 +46,9 @@ namespace gtsam {
     static std::pair<boost::shared_ptr<ConditionalType>, boost::shared_ptr<FactorType> >
       DefaultEliminate(const FactorGraphType& factors, const Ordering& keys) {
         return EliminateSymbolic(factors, keys); }
+    /// The scalar dimension of a key, used to estimate the cost of elimination
+    static size_t KeyDimension(const FactorType&, FactorType::const_iterator) {
+      return 1; }
   };
 
   /* ************************************************************************* */
@@ -147,6 +147,13 @@ TEST(EliminationTree, Create2)
   SymbolicEliminationTree actual(graph, order);
 
   EXPECT(assert_equal(expected, actual));
+
+  // The nodes know the sizes of their subtrees
+  const SymbolicEliminationTree::sharedNode root = actual.roots().front();
+  LONGS_EQUAL(8, root->subtreeSize);
+  LONGS_EQUAL(2, root->children.size());
+  const size_t size0 = root->children[0]->subtreeSize, size1 = root->children[1]->subtreeSize;
+  EXPECT((size0 == 3 && size1 == 4) || (size0 == 4 && size1 == 3));
 }
 
 /* ************************************************************************* */
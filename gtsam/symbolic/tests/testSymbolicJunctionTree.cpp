@@ -57,6 +57,20 @@ TEST( JunctionTree, constructor )
   EXPECT(assert_equal(*simpleChain[1],   *actual.roots().front()->children.front()->factors[1]));
 }
 
+/* ************************************************************************* */
+TEST( JunctionTree, cost )
+{
+  Ordering order; order += 0, 1, 2, 3;
+
+  SymbolicJunctionTree actual(SymbolicEliminationTree(simpleChain, order));
+
+  // Clique 0 1 : 2 has 2 frontal variables and 1 separator variable, the root
+  // clique 2 3 has no separator, and its cost includes that of its child
+  const double childCost = 8.0 / 3.0 + 4.0 + 2.0, rootCost = 8.0 / 3.0;
+  DOUBLES_EQUAL(childCost, actual.roots().front()->children.front()->cost(), 1e-9);
+  DOUBLES_EQUAL(rootCost + childCost, actual.roots().front()->cost(), 1e-9);
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
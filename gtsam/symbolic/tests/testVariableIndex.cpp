@@ -89,6 +89,31 @@ TEST(VariableIndex, augment2) {
   EXPECT(assert_equal(expected, actual));
 }
 
+/* ************************************************************************* */
+TEST(VariableIndex, augmentLarge) {
+  // A graph large enough to be indexed in parallel, with keys spread over several ranges
+  SymbolicFactorGraph graph;
+  for (size_t i = 0; i < 20000; ++i) {
+    graph.push_factor(i, (i * 7919) % 20000);
+    graph.push_factor(1000000 + i % 100, i);
+    if (i % 10 == 0) graph.push_back(SymbolicFactor::shared_ptr());
+  }
+
+  // Adding the factors one at a time does not use the parallel path
+  VariableIndex expected;
+  for (const SymbolicFactor::shared_ptr& factor : graph) {
+    SymbolicFactorGraph single;
+    single.push_back(factor);
+    expected.augment(single);
+  }
+
+  VariableIndex actual(graph);
+  LONGS_EQUAL(expected.size(), actual.size());
+  LONGS_EQUAL(expected.nEntries(), actual.nEntries());
+  LONGS_EQUAL(expected.nFactors(), actual.nFactors());
+  EXPECT(assert_equal(expected, actual));
+}
+
 /* ************************************************************************* */
 TEST(VariableIndex, remove) {
 
@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ConcurrentFilteringAndSmoothingRuntime.h
+ * @brief   Runs a concurrent filter on the calling thread and its smoother on a background
+ *          thread, synchronizing them whenever the smoother is done.
+ * @date    Oct 2026
+ */
+
+// \callgraph
+#pragma once
+
+#include <gtsam_unstable/nonlinear/ConcurrentFilteringAndSmoothing.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace gtsam {
+
+/**
+ * A runtime for the Concurrent Filtering and Smoothing architecture. The filter is updated on the
+ * calling thread, and the smoother runs its updates on a background worker thread.
+ *
+ * Each call to update() first updates the filter. If the smoother has finished its previous update,
+ * the filter and smoother are then synchronized with gtsam::synchronize. After that, the next smoother
+ * update starts on the worker, with the factors the filter handed over. A filter update never waits for
+ * a smoother update. Its latency is the filter update plus at most one synchronization, and a
+ * synchronization only exchanges the summarized factors and separator values.
+ *
+ * An atomic flag passes ownership of the smoother between the two threads. The worker only touches the
+ * smoother while an update runs, and the calling thread only while the smoother is idle, so the
+ * summarized factors are handed over without locks. A mutex is only taken to wake up the idle worker,
+ * or to wait for it in flush() and in the destructor.
+ *
+ * The filter and smoother share some factors and read them concurrently. As with the parallel
+ * NonlinearFactorGraph::linearize, their linearize() must therefore be safe to call from two threads.
+ *
+ * FILTER and SMOOTHER are e.g. ConcurrentBatchFilter and ConcurrentBatchSmoother, or
+ * ConcurrentIncrementalFilter and ConcurrentIncrementalSmoother.
+ */
+template <class FILTER, class SMOOTHER>
+class ConcurrentFilteringAndSmoothingRuntime {
+public:
+  typedef typename FILTER::Result FilterResult;
+  typedef typename SMOOTHER::Result SmootherResult;
+
+  /** Start the smoother worker, with copies of the given filter and smoother */
+  ConcurrentFilteringAndSmoothingRuntime(const FILTER& filter = FILTER(),
+      const SMOOTHER& smoother = SMOOTHER()) :
+      filter_(filter), smoother_(smoother), nrSynchronizations_(0), busy_(false),
+      requested_(false), stop_(false), worker_(&ConcurrentFilteringAndSmoothingRuntime::run, this) {
+  }
+
+  /** Wait for a running smoother update to finish, and stop the worker */
+  ~ConcurrentFilteringAndSmoothingRuntime() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_all();
+    worker_.join();
+  }
+
+  ConcurrentFilteringAndSmoothingRuntime(const ConcurrentFilteringAndSmoothingRuntime&) = delete;
+  ConcurrentFilteringAndSmoothingRuntime& operator=(const ConcurrentFilteringAndSmoothingRuntime&) = delete;
+
+  /**
+   * Update the filter on the calling thread, with the arguments of FILTER::update. After the filter
+   * update, if the smoother is idle, synchronize with it and start its next update in the background.
+   * Rethrows any exception thrown by the previous smoother update.
+   */
+  template <typename... ARGS>
+  FilterResult update(ARGS&&... args) {
+    FilterResult result = filter_.update(std::forward<ARGS>(args)...);
+    if (!busy_.load(std::memory_order_acquire))
+      synchronizeAndStart();
+    return result;
+  }
+
+  /**
+   * Queue factors to be added directly to the smoother, e.g. loop closures between smoother states.
+   * They are passed to the smoother update that starts at the next synchronization.
+   */
+  void addSmootherFactors(const NonlinearFactorGraph& factors, const Values& values = Values()) {
+    smootherFactors_.push_back(factors);
+    smootherValues_.insert(values);
+  }
+
+  /**
+   * Bring the filter and smoother fully up to date, blocking the calling thread. This waits for the
+   * running smoother update, synchronizes, runs one more smoother update, and synchronizes again, so
+   * that the filter has the summarization of everything the smoother knows.
+   */
+  void flush() {
+    waitForSmoother();
+    synchronizeAndStart();
+    waitForSmoother();
+    synchronize(filter_, smoother_);
+    ++nrSynchronizations_;
+  }
+
+  /** Block until the smoother is idle. Rethrows any exception thrown by the smoother update. */
+  void waitForSmoother() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return !busy_.load(std::memory_order_acquire); });
+    }
+    rethrowSmootherError();
+  }
+
+  /** Whether a smoother update is running on the worker */
+  bool smootherBusy() const { return busy_.load(std::memory_order_acquire); }
+
+  /** The filter, only to be used from the thread that calls update() */
+  const FILTER& filter() const { return filter_; }
+
+  /** The smoother, only to be used while it is idle, e.g. after waitForSmoother() */
+  const SMOOTHER& smoother() const { return smoother_; }
+
+  /** The result of the last completed smoother update, only to be used while the smoother is idle */
+  const SmootherResult& smootherResult() const { return smootherResult_; }
+
+  /** The number of synchronizations so far */
+  size_t nrSynchronizations() const { return nrSynchronizations_; }
+
+private:
+  FILTER filter_;
+  SMOOTHER smoother_;
+  NonlinearFactorGraph smootherFactors_;  ///< Factors queued for the next smoother update
+  Values smootherValues_;                 ///< Values of the new variables in smootherFactors_
+  NonlinearFactorGraph updateFactors_;    ///< Factors of the running smoother update
+  Values updateValues_;                   ///< Values of the running smoother update
+  SmootherResult smootherResult_;
+  std::exception_ptr smootherError_;
+  size_t nrSynchronizations_;
+
+  std::atomic<bool> busy_;  ///< True from the start of a smoother update until it is done
+  bool requested_;          ///< A smoother update is waiting to be started, guarded by mutex_
+  bool stop_;               ///< The worker should exit, guarded by mutex_
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::thread worker_;      ///< Last, so it starts after all other members are constructed
+
+  /* Synchronize the idle smoother with the filter, and start its next update on the worker */
+  void synchronizeAndStart() {
+    rethrowSmootherError();
+    synchronize(filter_, smoother_);
+    ++nrSynchronizations_;
+    updateFactors_ = smootherFactors_;
+    updateValues_ = smootherValues_;
+    smootherFactors_ = NonlinearFactorGraph();
+    smootherValues_.clear();
+    busy_.store(true, std::memory_order_release);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      requested_ = true;
+    }
+    condition_.notify_all();
+  }
+
+  void rethrowSmootherError() {
+    if (smootherError_) {
+      std::exception_ptr error = smootherError_;
+      smootherError_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  /* The worker: run the requested smoother updates until stopped */
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      condition_.wait(lock, [this] { return requested_ || stop_; });
+      if (!requested_)
+        return;
+      requested_ = false;
+      lock.unlock();
+      try {
+        smootherResult_ = smoother_.update(updateFactors_, updateValues_);
+      } catch (...) {
+        smootherError_ = std::current_exception();
+      }
+      lock.lock();
+      busy_.store(false, std::memory_order_release);
+      condition_.notify_all();
+    }
+  }
+};
+
+} // namespace gtsam
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testConcurrentFilteringAndSmoothingRuntime.cpp
+ * @brief   Unit tests for running the concurrent filter and smoother on two threads
+ * @date    Oct 2026
+ */
+
+#include <gtsam_unstable/nonlinear/ConcurrentFilteringAndSmoothingRuntime.h>
+#include <gtsam_unstable/nonlinear/ConcurrentBatchFilter.h>
+#include <gtsam_unstable/nonlinear/ConcurrentBatchSmoother.h>
+#include <gtsam_unstable/nonlinear/ConcurrentIncrementalFilter.h>
+#include <gtsam_unstable/nonlinear/ConcurrentIncrementalSmoother.h>
+#include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+
+const SharedDiagonal noisePrior = noiseModel::Isotropic::Sigma(3, 0.1);
+const SharedDiagonal noiseOdometry = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+const SharedDiagonal noiseLoop = noiseModel::Diagonal::Sigmas(Vector3(0.5, 0.5, 0.25));
+const Pose2 odometry(0.6, -0.1, 0.05);
+const size_t nrPoses = 40, lag = 5;
+
+/* ************************************************************************* */
+// Drive a runtime along a chain of poses, moving the poses older than the lag to the smoother,
+// add a loop closure directly to the smoother, and flush. Returns the batch solution of all factors.
+template <class RUNTIME>
+Values runChain(RUNTIME& runtime) {
+  NonlinearFactorGraph allFactors;
+  Values allValues;
+
+  NonlinearFactorGraph newFactors;
+  Values newValues;
+  newFactors.addPrior(0, Pose2(), noisePrior);
+  newValues.insert(0, Pose2(0.1, 0.1, 0.1));
+  Pose2 pose;
+  for (size_t i = 1; i < nrPoses; ++i) {
+    pose = pose * odometry;
+    newFactors += BetweenFactor<Pose2>(i - 1, i, odometry, noiseOdometry);
+    newValues.insert(i, pose.retract(Vector3(0.05, -0.05, 0.02)));
+
+    FastList<Key> keysToMove;
+    if (i > lag) keysToMove.push_back(i - lag - 1);
+
+    allFactors.push_back(newFactors);
+    allValues.insert(newValues);
+    runtime.update(newFactors, newValues, keysToMove);
+    newFactors = NonlinearFactorGraph();
+    newValues.clear();
+
+    // Halfway through, a loop closure between two poses that are now in the smoother
+    if (i == nrPoses / 2) {
+      NonlinearFactorGraph loop;
+      loop += BetweenFactor<Pose2>(0, 5, odometry * odometry * odometry * odometry * odometry,
+                                   noiseLoop);
+      allFactors.push_back(loop);
+      runtime.waitForSmoother();
+      runtime.addSmootherFactors(loop);
+    }
+  }
+  runtime.flush();
+
+  LevenbergMarquardtParams parameters;
+  parameters.maxIterations = 100;
+  return LevenbergMarquardtOptimizer(allFactors, allValues, parameters).optimize();
+}
+
+const Key last = nrPoses - 1;
+
+}  // namespace
+
+/* ************************************************************************* */
+TEST(ConcurrentFilteringAndSmoothingRuntime, batch) {
+  ConcurrentFilteringAndSmoothingRuntime<ConcurrentBatchFilter, ConcurrentBatchSmoother> runtime;
+  const Values expected = runChain(runtime);
+  EXPECT(!runtime.smootherBusy());
+  EXPECT(runtime.nrSynchronizations() > 2);
+  EXPECT(assert_equal(expected.at<Pose2>(last), runtime.filter().calculateEstimate<Pose2>(last), 1e-4));
+  EXPECT(assert_equal(expected.at<Pose2>(0), runtime.smoother().calculateEstimate<Pose2>(0), 1e-4));
+}
+
+/* ************************************************************************* */
+TEST(ConcurrentFilteringAndSmoothingRuntime, incremental) {
+  ISAM2Params parameters;
+  parameters.relinearizeThreshold = 0.0;
+  parameters.relinearizeSkip = 1;
+  ConcurrentFilteringAndSmoothingRuntime<ConcurrentIncrementalFilter, ConcurrentIncrementalSmoother>
+      runtime((ConcurrentIncrementalFilter(parameters)), ConcurrentIncrementalSmoother(parameters));
+  const Values expected = runChain(runtime);
+  EXPECT(!runtime.smootherBusy());
+  EXPECT(runtime.nrSynchronizations() > 2);
+  EXPECT(assert_equal(expected.at<Pose2>(last), runtime.filter().calculateEstimate<Pose2>(last), 1e-4));
+  EXPECT(assert_equal(expected.at<Pose2>(0), runtime.smoother().calculateEstimate<Pose2>(0), 1e-4));
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
+/* ************************************************************************* */
@@ -27,6 +27,8 @@
 #include <boost/assign/list_of.hpp>
 #include <boost/range/adaptor/map.hpp>
 using namespace boost::assign;
+
+#include <limits>
 namespace br { using namespace boost::adaptors; using namespace boost::range; }
 
 using namespace std;
@@ -618,6 +620,70 @@ TEST(ISAM2, slamlike_solution_partial_relinearization_check)
   CHECK(isam_check(fullgraph, fullinit, isam, *this, result_));
 }
 
+/* ************************************************************************* */
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+TEST(ISAM2, slamlike_solution_metis)
+{
+  // These variables will be reused and accumulate factors and values
+  Values fullinit;
+  NonlinearFactorGraph fullgraph;
+  ISAM2Params params(ISAM2GaussNewtonParams(0.001), 0.0, 0, false);
+  params.setOrderingType("metis");
+  EXPECT(params.getOrderingType() == "METIS");
+  CHECK_EXCEPTION(params.setOrderingType("NATURAL"), std::invalid_argument);
+  ISAM2 isam = createSlamlikeISAM2(fullinit, fullgraph, params);
+
+  // Compare solutions
+  CHECK(isam_check(fullgraph, fullinit, isam, *this, result_));
+}
+#endif
+
+/* ************************************************************************* */
+TEST(ISAM2, parallel_linearization)
+{
+  // Relinearize all variables in every update, so each update linearizes many
+  // more factors than the parallel threshold
+  ISAM2Params serialParams(ISAM2GaussNewtonParams(0.001), 0.0, 1, true);
+  serialParams.parallelLinearizationThreshold = std::numeric_limits<size_t>::max();
+  ISAM2Params parallelParams = serialParams;
+  parallelParams.setParallelLinearizationThreshold(1);
+  EXPECT_LONGS_EQUAL(1, parallelParams.getParallelLinearizationThreshold());
+  ISAM2 serial(serialParams), parallel(parallelParams);
+
+  // A pose chain with loop closures, added in batches
+  const size_t nrPoses = 500, batchSize = 100;
+  for (size_t start = 0; start < nrPoses; start += batchSize) {
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    for (size_t i = start; i < start + batchSize; ++i) {
+      if (i == 0)
+        newFactors += PriorFactor<Pose2>(0, Pose2(), odoNoise);
+      else
+        newFactors += BetweenFactor<Pose2>(i - 1, i, Pose2(1.0, 0.0, 0.1), odoNoise);
+      if (i >= 20 && i % 10 == 0)
+        newFactors += BetweenFactor<Pose2>(i - 20, i, Pose2(0.5, 0.5, 0.2), odoNoise);
+      newValues.insert(i, Pose2(0.9 * i, 0.05 * i, 0.11 * i));
+    }
+    serial.update(newFactors, newValues);
+    parallel.update(newFactors, newValues);
+  }
+
+  // The relinearized factors, hence the Bayes tree and the estimate, are the same
+  EXPECT(assert_equal(serial.getLinearizationPoint(), parallel.getLinearizationPoint()));
+  EXPECT(assert_equal(GaussianFactorGraph(serial), GaussianFactorGraph(parallel), 1e-9));
+  EXPECT(assert_equal(serial.calculateEstimate(), parallel.calculateEstimate(), 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(ISAM2, unsupported_ordering_type)
+{
+  ISAM2Params params;
+  params.orderingType = Ordering::NATURAL;
+  CHECK_EXCEPTION(ISAM2 isam(params), std::invalid_argument);
+  params.orderingType = Ordering::CUSTOM;
+  CHECK_EXCEPTION(ISAM2 isam(params), std::invalid_argument);
+}
+
 namespace {
   bool checkMarginalizeLeaves(ISAM2& isam, const FastList<Key>& leafKeys) {
     Matrix expectedAugmentedHessian, expected3AugmentedHessian;
@@ -807,6 +873,25 @@ TEST(ISAM2, marginalCovariance)
   EXPECT(assert_equal(expected, actual));
 }
 
+/* ************************************************************************* */
+TEST(ISAM2, marginalCovarianceCache)
+{
+  ISAM2 isam = createSlamlikeISAM2();
+
+  // The marginal is cached in the clique until the next update
+  const Matrix first = isam.marginalCovariance(5);
+  EXPECT(isam[5]->cachedMarginals().exists(5));
+  EXPECT(assert_equal(first, isam.marginalCovariance(5)));
+
+  // Adding a factor changes the cliques above and around variable 0, which drops the cache
+  NonlinearFactorGraph newFactors;
+  newFactors.addPrior(0, Pose2(0.0, 0.0, 0.0), odoNoise);
+  isam.update(newFactors);
+  EXPECT(!isam[5]->cachedMarginals().exists(5));
+  Matrix expected = Marginals(isam.getFactorsUnsafe(), isam.getLinearizationPoint()).marginalCovariance(5);
+  EXPECT(assert_equal(expected, isam.marginalCovariance(5)));
+}
+
 /* ************************************************************************* */
 TEST(ISAM2, calculate_nnz)
 {
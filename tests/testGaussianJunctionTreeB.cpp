@@ -272,6 +272,25 @@ TEST( GaussianJunctionTreeB, constructor2 ) {
 //  EXPECT(assert_equal(expected, actual3));
 //}
 
+/* ************************************************************************* */
+TEST( GaussianJunctionTreeB, cost ) {
+  // Chain 1 - 0 - 2 - 3 of 3-dimensional variables
+  GaussianFactorGraph gfg;
+  const SharedDiagonal model = noiseModel::Unit::Create(3);
+  gfg += JacobianFactor(1, I_3x3, 0, -I_3x3, Vector3::Zero(), model);
+  gfg += JacobianFactor(0, I_3x3, 2, -I_3x3, Vector3::Zero(), model);
+  gfg += JacobianFactor(2, I_3x3, 3, -I_3x3, Vector3::Zero(), model);
+  const Ordering order(KeyVector{0, 1, 2, 3});
+
+  GaussianJunctionTree actual(GaussianEliminationTree(gfg, order));
+
+  // Clique 0 1 : 2 has 6 frontal and 3 separator scalar dimensions, the root
+  // clique 2 3 has no separator, and its cost includes that of its child
+  const double childCost = 216.0 / 3.0 + 36.0 * 3.0 + 6.0 * 9.0, rootCost = 216.0 / 3.0;
+  DOUBLES_EQUAL(childCost, actual.roots().front()->children.front()->cost(), 1e-9);
+  DOUBLES_EQUAL(rootCost + childCost, actual.roots().front()->cost(), 1e-9);
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -258,6 +258,48 @@ TEST(Marginals, order) {
   testMarginals(marginals, set);
 }
 
+/* ************************************************************************* */
+TEST(Marginals, marginalCovariances) {
+  // A loop of poses observing landmarks, so that the Bayes tree has cliques with separators
+  NonlinearFactorGraph fg;
+  Values vals;
+  const SharedDiagonal odometryNoise = noiseModel::Diagonal::Sigmas(Vector3(0.2, 0.1, 0.05));
+  const SharedDiagonal measurementNoise = noiseModel::Diagonal::Sigmas(Vector2(0.05, 0.3));
+  fg.addPrior(Symbol('x', 0), Pose2(), odometryNoise);
+  for (size_t i = 0; i < 12; ++i) {
+    const Pose2 pose(3.0 * cos(0.5 * i), 3.0 * sin(0.5 * i), 0.5 * i + M_PI_2);
+    vals.insert(Symbol('x', i), pose);
+    if (i > 0)
+      fg += BetweenFactor<Pose2>(Symbol('x', i - 1), Symbol('x', i),
+          vals.at<Pose2>(Symbol('x', i - 1)).between(pose), odometryNoise);
+  }
+  fg += BetweenFactor<Pose2>(Symbol('x', 11), Symbol('x', 0),
+      vals.at<Pose2>(Symbol('x', 11)).between(vals.at<Pose2>(Symbol('x', 0))), odometryNoise);
+  for (size_t j = 0; j < 4; ++j) {
+    const Point2 landmark(cos(1.5 * j), sin(1.5 * j));
+    vals.insert(Symbol('l', j), landmark);
+    for (size_t i = 3 * j; i < 3 * j + 3; ++i) {
+      const Pose2& pose = vals.at<Pose2>(Symbol('x', i));
+      fg += BearingRangeFactor<Pose2, Point2>(Symbol('x', i), Symbol('l', j),
+          pose.bearing(landmark), pose.range(landmark), measurementNoise);
+    }
+  }
+
+  for (Marginals::Factorization factorization : {Marginals::CHOLESKY, Marginals::QR}) {
+    const Marginals marginals(fg, vals, factorization);
+    const FastMap<Key, Matrix> all = marginals.marginalCovariances();
+    LONGS_EQUAL(vals.size(), all.size());
+    for (Key key : vals.keys())
+      EXPECT(assert_equal(marginals.marginalCovariance(key), all.at(key), 1e-8));
+
+    const KeyVector some {Symbol('x', 5), Symbol('l', 2)};
+    const FastMap<Key, Matrix> actual = marginals.marginalCovariances(some);
+    LONGS_EQUAL(2, actual.size());
+    for (Key key : some)
+      EXPECT(assert_equal(marginals.marginalCovariance(key), actual.at(key), 1e-8));
+  }
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
 /* ************************************************************************* */
@@ -66,6 +66,27 @@ TEST( NonlinearFactorGraph, error )
   DOUBLES_EQUAL( 5.625, actual2, 1e-9 );
 }
 
+/* ************************************************************************* */
+TEST( NonlinearFactorGraph, errors )
+{
+  NonlinearFactorGraph fg = createNonlinearFactorGraph();
+  fg.push_back(NonlinearFactor::shared_ptr()); // null factors have zero error
+  Values c2 = createNoisyValues();
+
+  Vector expected(fg.size());
+  for (size_t i = 0; i < fg.size(); ++i)
+    expected[i] = fg[i] ? fg[i]->error(c2) : 0.0;
+  Vector actual = fg.errors(c2);
+  EXPECT(assert_equal(expected, actual));
+  DOUBLES_EQUAL(fg.error(c2), actual.sum(), 1e-9);
+
+  // Same with a pre-allocated buffer
+  std::vector<double> buffer(fg.size(), -1.0);
+  fg.errors(c2, buffer.data());
+  for (size_t i = 0; i < fg.size(); ++i)
+    DOUBLES_EQUAL(expected[i], buffer[i], 1e-9);
+}
+
 /* ************************************************************************* */
 TEST( NonlinearFactorGraph, keys )
 {
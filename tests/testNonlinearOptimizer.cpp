@@ -171,6 +171,31 @@ TEST( NonlinearOptimizer, optimization_method )
 
   Values actualMFChol = LevenbergMarquardtOptimizer(fg, c0, paramsChol).optimize();
   DOUBLES_EQUAL(0,fg.error(actualMFChol),tol);
+
+  LevenbergMarquardtParams paramsCholmod;
+  paramsCholmod.linearSolverType = LevenbergMarquardtParams::CHOLMOD;
+  Values actualCholmod = LevenbergMarquardtOptimizer(fg, c0, paramsCholmod).optimize();
+  DOUBLES_EQUAL(0,fg.error(actualCholmod),tol);
+}
+
+/* ************************************************************************* */
+TEST( NonlinearOptimizer, Cholmod )
+{
+  NonlinearFactorGraph fg = example::createNonlinearFactorGraph();
+  Values c0 = example::createNoisyValues();
+
+  // The sparse Cholesky solver should follow the same trajectory as multifrontal Cholesky
+  LevenbergMarquardtParams paramsChol, paramsCholmod;
+  paramsCholmod.linearSolverType = LevenbergMarquardtParams::CHOLMOD;
+  LevenbergMarquardtOptimizer expected(fg, c0, paramsChol), actual(fg, c0, paramsCholmod);
+  EXPECT(assert_equal(expected.optimize(), actual.optimize()));
+  EXPECT_LONGS_EQUAL(expected.iterations(), actual.iterations());
+
+  // Also for Gauss-Newton, which has no damping
+  GaussNewtonParams gnParams;
+  gnParams.linearSolverType = GaussNewtonParams::CHOLMOD;
+  EXPECT(assert_equal(GaussNewtonOptimizer(fg, c0).optimize(),
+                      GaussNewtonOptimizer(fg, c0, gnParams).optimize()));
 }
 
 /* ************************************************************************* */
@@ -337,6 +362,65 @@ TEST_UNSAFE(NonlinearOptimizer, MoreOptimization) {
   }
 }
 
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, ReuseEliminationStructure) {
+  NonlinearFactorGraph fg = example::createNonlinearFactorGraph();
+  Values init = example::createNoisyValues();
+
+  for (bool diagonalDamping : {false, true}) {
+    for (auto solverType : {NonlinearOptimizerParams::MULTIFRONTAL_CHOLESKY,
+                            NonlinearOptimizerParams::MULTIFRONTAL_QR}) {
+      LevenbergMarquardtParams params;
+      params.diagonalDamping = diagonalDamping;
+      params.linearSolverType = solverType;
+      params.lambdaInitial = 1.0;
+      LevenbergMarquardtParams reuseParams = params;
+      reuseParams.reuseEliminationStructure = true;
+
+      // Damping during elimination should give the same step as the damped system
+      LevenbergMarquardtOptimizer optimizer(fg, init, reuseParams);
+      GaussianFactorGraph::shared_ptr linear = optimizer.linearize();
+      VectorValues sqrtHessianDiagonal = linear->hessianDiagonal();
+      for (Vector& v : sqrtHessianDiagonal | map_values) v = v.cwiseSqrt();
+      VectorValues expectedDelta =
+          optimizer.buildDampedSystem(*linear, sqrtHessianDiagonal).optimize();
+      EXPECT(assert_equal(expectedDelta, optimizer.solveDamped(*linear, sqrtHessianDiagonal)));
+
+      // And hence the same optimization trajectory
+      LevenbergMarquardtOptimizer expected(fg, init, params);
+      LevenbergMarquardtOptimizer actual(fg, init, reuseParams);
+      EXPECT(assert_equal(expected.optimize(), actual.optimize()));
+      EXPECT_LONGS_EQUAL(expected.iterations(), actual.iterations());
+      EXPECT_LONGS_EQUAL(expected.getInnerIterations(), actual.getInnerIterations());
+    }
+  }
+}
+
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, RelinearizeThreshold) {
+  // A loop of poses, starting far from the solution
+  NonlinearFactorGraph fg;
+  const SharedNoiseModel odometryNoise = noiseModel::Diagonal::Sigmas(Vector3(0.2, 0.2, 0.1));
+  fg.addPrior(0, Pose2(0, 0, 0), noiseModel::Isotropic::Sigma(3, 0.1));
+  for (size_t i = 0; i < 8; ++i)
+    fg += BetweenFactor<Pose2>(i, (i + 1) % 8, Pose2(1, 0, M_PI / 4), odometryNoise);
+  Values init;
+  for (size_t i = 0; i < 8; ++i)
+    init.insert(i, Pose2(0.5 * i, 0.3 * i, 0.5 * i));
+
+  LevenbergMarquardtParams params;
+  params.relativeErrorTol = 1e-10;
+  params.absoluteErrorTol = 1e-10;
+  LevenbergMarquardtParams cachedParams = params;
+  cachedParams.relinearizeThreshold = 1e-3;
+
+  // Factors are only relinearized when their variables moved, which should not change the result
+  const Values expected = LevenbergMarquardtOptimizer(fg, init, params).optimize();
+  LevenbergMarquardtOptimizer optimizer(fg, init, cachedParams);
+  EXPECT(assert_equal(expected, optimizer.optimize(), 1e-5));
+  DOUBLES_EQUAL(fg.error(expected), optimizer.error(), 1e-8);
+}
+
 /* ************************************************************************* */
 TEST(NonlinearOptimizer, Pose2OptimizationWithHuberNoOutlier) {
 
@@ -20,6 +20,7 @@
 #include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/HessianFactor.h>
 #include <gtsam/linear/SubgraphPreconditioner.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/base/Matrix.h>
@@ -124,6 +125,33 @@ TEST( GaussianFactorGraphSystem, multiply_getb)
   EXPECT(assert_equal(expectedb, actualb, 1e-3));
 }
 
+/* ************************************************************************* */
+TEST(BlockSparseOperator, multiply)
+{
+  // Jacobian factors with different noise models, and a Hessian factor
+  GaussianFactorGraph gfg;
+  gfg += JacobianFactor(2, (Matrix(2,2)<< 10, 1, 0, 10).finished(), (Vector(2) << -1, -1).finished(),
+                        noiseModel::Diagonal::Sigmas(Vector2(0.5, 0.3)));
+  gfg += JacobianFactor(2, (Matrix(1,2)<< -10, 3).finished(), 0, (Matrix(1,3)<< 1, 2, 3).finished(),
+                        (Vector(1) << 2).finished());
+  gfg += JacobianFactor(0, I_3x3, Vector3(1, 2, 3), noiseModel::Isotropic::Sigma(3, 0.1));
+  gfg += HessianFactor(1, 0, (Matrix(1,1) << 4).finished(), (Matrix(1,3) << 1, 0, -1).finished(),
+                       Vector1(2), 5 * I_3x3, Vector3(-1, 0, 1), 3.0);
+
+  // A non-natural ordering
+  const Ordering ordering(KeyVector{1, 2, 0});
+  const KeyInfo keyInfo(gfg, ordering);
+  const BlockSparseOperator A(gfg, keyInfo);
+  const pair<Matrix, Vector> hessian = gfg.hessian(ordering);
+  LONGS_EQUAL(6, A.cols());
+  EXPECT(assert_equal(hessian.second, A.rhs()));
+
+  const Vector x = (Vector(6) << 1, -2, 3, 0.5, -1, 2).finished();
+  Vector y;
+  A.multiply(x, y);
+  EXPECT(assert_equal(Vector(hessian.first * x), y, 1e-9));
+}
+
 /* ************************************************************************* */
 // Test Dummy Preconditioner
 TEST(PCGSolver, dummy) {
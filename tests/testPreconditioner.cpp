@@ -18,11 +18,13 @@
 
 #include <CppUnitLite/TestHarness.h>
 
+#include <tests/smallExample.h>
 #include <gtsam/nonlinear/Values.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/linear/Preconditioner.h>
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/IterativeSolver.h>
 #include <gtsam/geometry/Point2.h>
 
 using namespace std;
@@ -124,6 +126,107 @@ TEST(PCGSolver, simpleLinearSystem) {
 
 }
 
+/* ************************************************************************* */
+TEST(IncompleteCholeskyPreconditioner, exactOnChain) {
+  // A chain in natural order has no fill-in, so IC(0) is the exact Cholesky factor
+  const GaussianFactorGraph gfg = example::createSmoother(7);
+  const KeyInfo keyInfo(gfg);
+  IncompleteCholeskyPreconditioner preconditioner;
+  preconditioner.build(gfg, keyInfo, std::map<Key, Vector>());
+
+  const Matrix H = gfg.hessian(keyInfo.ordering()).first;
+  const Vector b = Vector::LinSpaced(H.rows(), -1.0, 2.0);
+  Vector y, x;
+  preconditioner.solve(b, y);
+  preconditioner.transposeSolve(y, x);
+  EXPECT(assert_equal(Vector(H.llt().solve(b)), x, 1e-9));
+  Vector z;
+  preconditioner.fullSolve(b, z);
+  EXPECT(assert_equal(x, z, 1e-12));
+}
+
+/* ************************************************************************* */
+TEST(MultilevelPreconditioner, symmetric) {
+  const GaussianFactorGraph gfg = example::planarGraph(8).first;
+  const KeyInfo keyInfo(gfg);
+  MultilevelPreconditioner preconditioner(MultilevelPreconditionerParameters(10, 4));
+  preconditioner.build(gfg, keyInfo, std::map<Key, Vector>());
+  EXPECT(preconditioner.nrLevels() > 2);
+
+  // The V-cycle has to be a symmetric operator for conjugate gradients
+  const Vector u = Vector::LinSpaced(keyInfo.numCols(), -1.0, 2.0);
+  const Vector v = Vector::LinSpaced(keyInfo.numCols(), 3.0, 1.0).cwiseProduct(u);
+  Vector Mu, Mv;
+  preconditioner.fullSolve(u, Mu);
+  preconditioner.fullSolve(v, Mv);
+  DOUBLES_EQUAL(v.dot(Mu), u.dot(Mv), 1e-9 * std::abs(v.dot(Mu)));
+
+  // It splits into L^{-T} L^{-1}, with L^{-1} mapping to the variables of all levels
+  Vector y, x;
+  preconditioner.solve(u, y);
+  EXPECT(y.size() > u.size());
+  preconditioner.transposeSolve(y, x);
+  EXPECT(assert_equal(Mu, x, 1e-9));
+  EXPECT_DOUBLES_EQUAL(u.dot(Mu), y.squaredNorm(), 1e-9 * u.dot(Mu));
+}
+
+/* ************************************************************************* */
+TEST(PCGSolver, planarGraph) {
+  const GaussianFactorGraph gfg = example::planarGraph(8).first;
+  const VectorValues deltaDirect = gfg.optimize();
+
+  gtsam::PCGSolverParameters::shared_ptr pcg = boost::make_shared<gtsam::PCGSolverParameters>();
+  pcg->setMaxIterations(500);
+  pcg->setEpsilon_abs(0.0);
+  pcg->setEpsilon_rel(1e-12);
+
+  // With Incomplete-Cholesky preconditioner
+  pcg->preconditioner_ = boost::make_shared<gtsam::IncompleteCholeskyPreconditionerParameters>();
+  VectorValues deltaPCGCholesky = PCGSolver(*pcg).optimize(gfg);
+  EXPECT(assert_equal(deltaDirect, deltaPCGCholesky, 1e-5));
+
+  // With multilevel preconditioner, coarsening down to a few variables
+  pcg->preconditioner_ = boost::make_shared<gtsam::MultilevelPreconditionerParameters>(10, 4);
+  VectorValues deltaPCGMultilevel = PCGSolver(*pcg).optimize(gfg);
+  EXPECT(assert_equal(deltaDirect, deltaPCGMultilevel, 1e-5));
+}
+
+/* ************************************************************************* */
+namespace {
+// A System with only the split preconditioner interface, as written before precondition()
+struct SplitPreconditionedSystem {
+  const GaussianFactorGraphSystem& system;
+  void residual(const Vector& x, Vector& r) const { system.residual(x, r); }
+  void multiply(const Vector& x, Vector& y) const { system.multiply(x, y); }
+  void leftPrecondition(const Vector& x, Vector& y) const { system.leftPrecondition(x, y); }
+  void rightPrecondition(const Vector& x, Vector& y) const { system.rightPrecondition(x, y); }
+  void scal(const double alpha, Vector& x) const { system.scal(alpha, x); }
+  double dot(const Vector& x, const Vector& y) const { return system.dot(x, y); }
+  void axpy(const double alpha, const Vector& x, Vector& y) const { system.axpy(alpha, x, y); }
+};
+}
+
+TEST(PCGSolver, splitPreconditioner) {
+  const GaussianFactorGraph gfg = example::planarGraph(8).first;
+  const KeyInfo keyInfo(gfg);
+  const std::map<Key, Vector> lambda;
+  MultilevelPreconditioner preconditioner(MultilevelPreconditionerParameters(10, 4));
+  preconditioner.build(gfg, keyInfo, lambda);
+  const GaussianFactorGraphSystem system(gfg, preconditioner, keyInfo, lambda);
+
+  ConjugateGradientParameters parameters;
+  parameters.setMaxIterations(500);
+  parameters.setEpsilon_abs(0.0);
+  parameters.setEpsilon_rel(1e-12);
+  const Vector x0 = Vector::Zero(keyInfo.numCols());
+
+  // Systems without precondition() still work, through L^{-1} and L^{-T}
+  const Vector expected = preconditionedConjugateGradient(system, x0, parameters);
+  const Vector actual =
+      preconditionedConjugateGradient(SplitPreconditionedSystem{system}, x0, parameters);
+  EXPECT(assert_equal(expected, actual, 1e-6));
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr); }
 /* ************************************************************************* */
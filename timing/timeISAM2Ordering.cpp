@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeISAM2Ordering.cpp
+ * @brief   Compares the fill and update time of iSAM2 with COLAMD and METIS orderings
+ * @date    Oct 2026
+ *
+ * Usage: timeISAM2Ordering [dataset] [steps]
+ * The dataset is a 2D pose graph found by findExampleDataFile (default w20000), of which
+ * the poses are added one per update, as in timeIncremental.  For reference, the fill of
+ * eliminating the same graph in a single batch is printed as well.
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/slam/dataset.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/nonlinear/ISAM2.h>
+#include <gtsam/symbolic/SymbolicBayesTree.h>
+#include <gtsam/symbolic/SymbolicFactorGraph.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+using namespace gtsam;
+
+typedef Pose2 Pose;
+
+namespace {
+
+// Number of nonzeros in the R and S matrices of the cliques in a subtree
+size_t nonzerosInR(const ISAM2::sharedClique& clique) {
+  const GaussianConditional& conditional = *clique->conditional();
+  const size_t frontalDim = conditional.rows();
+  const size_t separatorDim = conditional.get_S().cols();
+  size_t nonzeros = frontalDim * (frontalDim + 1) / 2 + frontalDim * separatorDim;
+  for (const ISAM2::sharedClique& child : clique->children)
+    nonzeros += nonzerosInR(child);
+  return nonzeros;
+}
+
+// Nonzeros in R when eliminating all poses at once, from the symbolic factorization
+void batch(const string& name, Ordering::OrderingType orderingType,
+           const NonlinearFactorGraph& measurements, size_t steps) {
+  SymbolicFactorGraph graph;
+  for (const NonlinearFactor::shared_ptr& measurement : measurements) {
+    const KeyVector& keys = measurement->keys();
+    if (*std::max_element(keys.begin(), keys.end()) <= steps)
+      graph.push_back(SymbolicFactor::FromKeys(keys));
+  }
+
+  gttic_(Batch_ordering);
+  const Ordering ordering = Ordering::Create(orderingType, graph);
+  gttoc_(Batch_ordering);
+  tictoc_getNode(orderingNode, Batch_ordering);
+  const SymbolicBayesTree::shared_ptr bayesTree = graph.eliminateMultifrontal(ordering);
+
+  const size_t dim = Pose::dimension;
+  size_t nonzeros = 0;
+  for (const auto& keyClique : bayesTree->nodes()) {
+    const SymbolicConditional& conditional = *keyClique.second->conditional();
+    if (conditional.firstFrontalKey() != keyClique.first) continue;
+    const size_t frontalDim = dim * conditional.nrFrontals();
+    nonzeros += frontalDim * (frontalDim + 1) / 2 + frontalDim * dim * conditional.nrParents();
+  }
+  cout << name << " batch: " << nonzeros << " nonzeros in R, " << orderingNode->wall()
+       << " s in ordering" << endl;
+}
+
+// Add the poses of the dataset one step at a time, and print the fill and update time
+void run(const string& name, Ordering::OrderingType orderingType,
+         const NonlinearFactorGraph& measurements, size_t steps) {
+  ISAM2Params params;
+  params.relinearizeSkip = 1;
+  params.orderingType = orderingType;
+  ISAM2 isam2(params);
+
+  tictoc_reset_();
+  size_t nextMeasurement = 0;
+  for (size_t step = 1; step <= steps && nextMeasurement < measurements.size(); ++step) {
+    Values newVariables;
+    NonlinearFactorGraph newFactors;
+
+    if (step == 1) {
+      newVariables.insert(0, Pose());
+      newFactors.addPrior(0, Pose(), noiseModel::Unit::Create(3));
+    }
+    while (nextMeasurement < measurements.size()) {
+      BetweenFactor<Pose>::shared_ptr measurement =
+          boost::dynamic_pointer_cast<BetweenFactor<Pose> >(measurements[nextMeasurement]);
+      if (!measurement)
+        throw runtime_error("Only datasets of 2D pose constraints are supported");
+
+      // Stop collecting measurements that are for future steps
+      if (measurement->key1() > step || measurement->key2() > step) break;
+      newFactors.push_back(measurement);
+
+      // Initialize the new pose from odometry
+      if (measurement->key1() == step - 1 && measurement->key2() == step) {
+        const Pose previous = step == 1 ? Pose() : isam2.calculateEstimate<Pose>(step - 1);
+        newVariables.insert(step, previous * measurement->measured());
+      } else if (measurement->key1() == step && measurement->key2() == step - 1) {
+        const Pose previous = step == 1 ? Pose() : isam2.calculateEstimate<Pose>(step - 1);
+        newVariables.insert(step, previous * measurement->measured().inverse());
+      }
+      ++nextMeasurement;
+    }
+    if (!newVariables.exists(step))
+      throw runtime_error("Problem in data file, missing odometry");
+
+    gttic_(Update_ISAM2);
+    isam2.update(newFactors, newVariables);
+    gttoc_(Update_ISAM2);
+    tictoc_finishedIteration_();
+  }
+
+  size_t nonzeros = 0, cliques = 0, largestClique = 0;
+  for (const ISAM2::sharedClique& root : isam2.roots()) nonzeros += nonzerosInR(root);
+  for (const auto& keyClique : isam2.nodes()) {
+    const size_t frontals = keyClique.second->conditional()->nrFrontals();
+    if (keyClique.second->conditional()->firstFrontalKey() == keyClique.first) {
+      ++cliques;
+      largestClique = max(largestClique, frontals + keyClique.second->conditional()->nrParents());
+    }
+  }
+
+  tictoc_getNode(updateNode, Update_ISAM2);
+  cout << name << ": " << isam2.getLinearizationPoint().size() << " variables, " << cliques
+       << " cliques (largest " << largestClique << " variables), " << nonzeros
+       << " nonzeros in R, " << updateNode->wall() << " s in update" << endl;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const string dataset = argc > 1 ? argv[1] : "w20000";
+  const size_t steps = argc > 2 ? atoi(argv[2]) : numeric_limits<size_t>::max();
+
+  cout << "Loading " << dataset << "..." << endl;
+  const NonlinearFactorGraph measurements = *load2D(findExampleDataFile(dataset)).first;
+
+  batch("COLAMD", Ordering::COLAMD, measurements, steps);
+  batch("METIS", Ordering::METIS, measurements, steps);
+  run("COLAMD", Ordering::COLAMD, measurements, steps);
+  run("METIS", Ordering::METIS, measurements, steps);
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timePreconditioners.cpp
+ * @brief   Time PCG with the block-Jacobi, incomplete-Cholesky and multilevel preconditioners
+ *          on the linearization of a 2D pose graph from examples/Data
+ * @date    Oct 2026
+ */
+
+#include <gtsam/slam/dataset.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/base/timing.h>
+
+#include <iostream>
+
+using namespace std;
+using namespace gtsam;
+
+int main(int argc, char *argv[]) {
+
+  // read graph, e.g. w100.graph, w20000 or noisyToyGraph
+  const string dataset = argc > 1 ? argv[1] : "w20000";
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) = load2D(findExampleDataFile(dataset));
+  graph->addPrior(0, initial->at<Pose2>(0), noiseModel::Isotropic::Sigma(3, 1e-3));
+  cout << dataset << ": " << initial->size() << " poses, " << graph->size() << " factors"
+       << endl;
+
+  // the first linear system of Gauss-Newton, from the odometry initialization
+  const GaussianFactorGraph::shared_ptr gfg = graph->linearize(*initial);
+  VectorValues direct;
+  {
+    gttic_(direct);
+    direct = gfg->optimize();
+  }
+
+  PCGSolverParameters pcg;
+  pcg.setMaxIterations(10000);
+  pcg.setReset(10001);  // never restart, which would drop the search directions built so far
+  pcg.setEpsilon_rel(1e-6);
+  pcg.setEpsilon_abs(0.0);
+  pcg.setVerbosity("COMPLEXITY");
+
+  const auto run = [&](const string& name,
+                       const PreconditionerParameters::shared_ptr& preconditioner) {
+    cout << name << endl;
+    pcg.preconditioner_ = preconditioner;
+    VectorValues delta;
+    {
+      gttic_(pcg);
+      delta = PCGSolver(pcg).optimize(*gfg);
+    }
+    cout << "  |delta - direct| = " << (delta - direct).norm() << endl;
+  };
+
+  {
+    gttic_(blockJacobi);
+    run("block-Jacobi", boost::make_shared<BlockJacobiPreconditionerParameters>());
+  }
+  {
+    gttic_(incompleteCholesky);
+    run("incomplete Cholesky", boost::make_shared<IncompleteCholeskyPreconditionerParameters>());
+  }
+  {
+    gttic_(multilevel);
+    run("multilevel", boost::make_shared<MultilevelPreconditionerParameters>());
+  }
+
+  tictoc_print_();
+
+  return 0;
+}
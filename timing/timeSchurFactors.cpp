@@ -12,7 +12,10 @@
 #include "gtsam/slam/JacobianFactorQR.h"
 #include <gtsam/slam/RegularImplicitSchurFactor.h>
 #include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/geometry/PinholeCamera.h>
 #include <gtsam/geometry/PinholePose.h>
+#include <gtsam/geometry/CameraSet.h>
 
 #include <boost/assign/list_of.hpp>
 #include <boost/assign/std/vector.hpp>
@@ -25,6 +28,7 @@ using namespace gtsam;
 #define SLOW
 #define RAW
 #define HESSIAN
+#define SCHUR
 #define NUM_ITERATIONS 1000
 
 // Create CSV file for results
@@ -120,6 +124,67 @@ void timeAll(size_t m, size_t N) {
 
 } // timeAll
 
+/*************************************************************************************/
+// CameraSet::SchurComplement as it was before the fixed-size kernels, for comparison
+template<int D, int N>
+SymmetricBlockMatrix referenceSchurComplement(
+    const vector<Eigen::Matrix<double, 2, D>, Eigen::aligned_allocator<Eigen::Matrix<double, 2, D>>>& Fs,
+    const Matrix& E, const Eigen::Matrix<double, N, N>& P, const Vector& b) {
+  size_t m = Fs.size();
+  size_t M1 = D * m + 1;
+  vector<DenseIndex> dims(m + 1);
+  fill(dims.begin(), dims.end() - 1, D);
+  dims.back() = 1;
+  SymmetricBlockMatrix augmentedHessian(dims, Matrix::Zero(M1, M1));
+  for (size_t i = 0; i < m; i++) {
+    const Eigen::Matrix<double, 2, D>& Fi = Fs[i];
+    const auto FiT = Fi.transpose();
+    const Eigen::Matrix<double, 2, N> Ei_P = E.block(2 * i, 0, 2, N) * P;
+    augmentedHessian.setOffDiagonalBlock(i, m, FiT * b.segment<2>(2 * i)
+        - FiT * (Ei_P * (E.transpose() * b)));
+    augmentedHessian.setDiagonalBlock(i, FiT
+        * (Fi - Ei_P * E.block(2 * i, 0, 2, N).transpose() * Fi));
+    for (size_t j = i + 1; j < m; j++) {
+      const Eigen::Matrix<double, 2, D>& Fj = Fs[j];
+      augmentedHessian.setOffDiagonalBlock(i, j, -FiT
+          * (Ei_P * E.block(2 * j, 0, 2, N).transpose() * Fj));
+    }
+  }
+  augmentedHessian.diagonalBlock(m)(0, 0) += b.squaredNorm();
+  return augmentedHessian;
+}
+
+/*************************************************************************************/
+// Time the Schur complement of a point seen in m cameras, in microseconds per call
+template<typename CAMERA>
+void timeSchurComplement(const string& name, size_t m, size_t N) {
+  static const int D = traits<CAMERA>::dimension;
+  typename CameraSet<CAMERA>::FBlocks Fs;
+  Matrix E(2 * m, 3);
+  for (size_t i = 0; i < m; i++) {
+    Fs.push_back(Eigen::Matrix<double, 2, D>::Random());
+    E.block<2, 3>(2 * i, 0) = Matrix23::Random();
+  }
+  const Matrix3 P = (E.transpose() * E).inverse();
+  const Vector b = Vector::Random(2 * m);
+
+  double reference = 0, fixed = 0;
+  {
+    clock_t start = clock();
+    for (size_t t = 0; t < N; t++)
+      referenceSchurComplement<D, 3>(Fs, E, P, b);
+    reference = double(clock() - start) / CLOCKS_PER_SEC * 1e6 / N;
+  }
+  {
+    clock_t start = clock();
+    for (size_t t = 0; t < N; t++)
+      CameraSet<CAMERA>::template SchurComplement<3>(Fs, E, P, b);
+    fixed = double(clock() - start) / CLOCKS_PER_SEC * 1e6 / N;
+  }
+  cout << name << ", m = " << m << ": " << reference << " -> " << fixed
+       << " musecs, speedup " << reference / fixed << endl;
+}
+
 /*************************************************************************************/
 int main(void) {
 #ifdef SLOW
@@ -152,6 +217,16 @@ int main(void) {
   // loop over number of images
   for(size_t m: ms)
     timeAll<PinholePose<Cal3Bundler> >(m, NUM_ITERATIONS);
+
+#ifdef SCHUR
+  // Oct 2026, single core, speedup of the fixed-size Schur complement kernels:
+  // D=6: 1.7x for m = 2, 1.9x for m = 10, 9.0x for m = 50
+  // D=9: 2.2x for m = 2, 2.6x for m = 10, 13x for m = 50
+  for (size_t m : {2, 5, 10, 20, 50}) {
+    timeSchurComplement<PinholePose<Cal3_S2> >("D=6 (PinholePose)", m, NUM_ITERATIONS);
+    timeSchurComplement<PinholeCamera<Cal3Bundler> >("D=9 (Cal3Bundler)", m, NUM_ITERATIONS);
+  }
+#endif
 }
 
 //*************************************************************************************
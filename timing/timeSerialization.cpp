@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeSerialization.cpp
+ * @brief   Time saving and loading a large pose graph and its values, with the boost binary
+ *          archive versus the compact binary format
+ * @date    Oct 2026
+ */
+
+#include <gtsam/base/serialization.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/nonlinear/BinarySerialization.h>
+#include <gtsam/slam/BetweenFactor.h>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <cstdio>
+#include <iostream>
+
+using namespace std;
+using namespace gtsam;
+
+// Export the types for the boost archive
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Gaussian, "gtsam_noiseModel_Gaussian");
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Diagonal, "gtsam_noiseModel_Diagonal");
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Isotropic, "gtsam_noiseModel_Isotropic");
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::Robust, "gtsam_noiseModel_Robust");
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::mEstimator::Base, "gtsam_noiseModel_mEstimator_Base");
+BOOST_CLASS_EXPORT_GUID(gtsam::noiseModel::mEstimator::Huber, "gtsam_noiseModel_mEstimator_Huber");
+GTSAM_VALUE_EXPORT(gtsam::Pose3);
+typedef PriorFactor<Pose3> PriorFactorPose3;
+typedef BetweenFactor<Pose3> BetweenFactorPose3;
+BOOST_CLASS_EXPORT_GUID(PriorFactorPose3, "gtsam::PriorFactorPose3");
+BOOST_CLASS_EXPORT_GUID(BetweenFactorPose3, "gtsam::BetweenFactorPose3");
+
+int main(int argc, char *argv[]) {
+  const size_t nrPoses = argc > 1 ? atoi(argv[1]) : 100000;
+  cout << "Saving and loading " << nrPoses << " poses and about " << 2 * nrPoses
+       << " factors" << endl;
+
+  // Odometry with a shared noise model, and loop closures with robust models of their own
+  NonlinearFactorGraph graph;
+  Values values;
+  const SharedNoiseModel odometryModel =
+      noiseModel::Diagonal::Sigmas((Vector6() << 0.01, 0.01, 0.01, 0.1, 0.1, 0.1).finished());
+  const Pose3 step(Rot3::Ypr(0.01, 0.02, 0.03), Point3(1, 0, 0));
+  graph.emplace_shared<PriorFactor<Pose3> >(0, Pose3(), odometryModel);
+  values.insert(0, Pose3());
+  for (size_t i = 1; i < nrPoses; ++i) {
+    graph.emplace_shared<BetweenFactor<Pose3> >(i - 1, i, step, odometryModel);
+    values.insert(i, values.at<Pose3>(i - 1) * step);
+    if (i >= 10)
+      graph.emplace_shared<BetweenFactor<Pose3> >(i - 10, i, step,
+          noiseModel::Robust::Create(noiseModel::mEstimator::Huber::Create(1.345),
+                                     noiseModel::Isotropic::Sigma(6, 0.1)));
+  }
+
+  const string boostGraph = "timeSerializationGraph.boost", boostValues = "timeSerializationValues.boost";
+  const string compactGraph = "timeSerializationGraph.bin", compactValues = "timeSerializationValues.bin";
+  NonlinearFactorGraph graphRead;
+  Values valuesRead;
+
+  {
+    gttic_(boost_save);
+    serializeToBinaryFile(graph, boostGraph);
+    serializeToBinaryFile(values, boostValues);
+  }
+  {
+    gttic_(boost_load);
+    deserializeFromBinaryFile(boostGraph, graphRead);
+    deserializeFromBinaryFile(boostValues, valuesRead);
+  }
+  {
+    gttic_(compact_save);
+    serializeToCompactFile(graph, compactGraph);
+    serializeToCompactFile(values, compactValues);
+  }
+  {
+    gttic_(compact_load);
+    deserializeFromCompactFile(compactGraph, graphRead);
+    deserializeFromCompactFile(compactValues, valuesRead);
+  }
+
+  namespace fs = boost::filesystem;
+  cout << "boost archive: " << fs::file_size(boostGraph) + fs::file_size(boostValues)
+       << " bytes, compact format: " << fs::file_size(compactGraph) + fs::file_size(compactValues)
+       << " bytes" << endl;
+  for (const string& file : {boostGraph, boostValues, compactGraph, compactValues})
+    remove(file.c_str());
+
+  tictoc_print_();
+  return 0;
+}
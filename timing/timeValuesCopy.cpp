@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeValuesCopy.cpp
+ * @brief   Time copying, retracting and destroying a large Values of poses and points, which
+ *          is dominated by allocating the variables, e.g. to compare GTSAM_VALUES_ARENA on/off
+ * @date    Oct 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/nonlinear/Values.h>
+
+#include <boost/optional.hpp>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::L;
+using symbol_shorthand::X;
+
+int main(int argc, char *argv[]) {
+  const size_t nrPoses = argc > 1 ? atoi(argv[1]) : 100000;
+  const size_t nrThreads = argc > 2 ? atoi(argv[2]) : 4;
+  const size_t nrPoints = 4 * nrPoses;
+  const size_t trials = 10;
+#ifdef GTSAM_VALUES_ARENA
+  cout << "Values arena ON: ";
+#else
+  cout << "Values arena OFF: ";
+#endif
+  cout << nrPoses << " poses and " << nrPoints << " points, " << trials << " times" << endl;
+
+  Values values;
+  VectorValues delta;
+  for (size_t i = 0; i < nrPoses; ++i) {
+    values.insert(X(i), Pose3(Rot3::Ypr(0.1 * i, 0.2, 0.3), Point3(i, 0, 0)));
+    delta.insert(X(i), (Vector6() << 0.01, -0.02, 0.03, 0.1, 0.2, 0.3).finished());
+  }
+  for (size_t j = 0; j < nrPoints; ++j) {
+    values.insert(L(j), Point3(j, 1, 2));
+    delta.insert(L(j), Vector3(0.1, 0.2, 0.3));
+  }
+
+  for (size_t t = 0; t < trials; ++t) {
+    boost::optional<Values> copy;
+    {
+      gttic_(copy);
+      copy = values;
+    }
+    {
+      gttic_(destroy);
+      copy.reset();
+    }
+    {
+      gttic_(retract);
+      copy = values.retract(delta);
+    }
+    {
+      gttic_(iterate);
+      double sum = 0.0;
+      for (const Values::ConstFiltered<Point3>::KeyValuePair& point : copy->filter<Point3>())
+        sum += point.value.x();
+      if (sum < 0.0) cout << sum << endl;
+    }
+    tictoc_finishedIteration_();
+  }
+
+  // Threads that each copy and destroy their own Values, as in parallel linearization
+  vector<Values> parts(nrThreads);
+  size_t i = 0;
+  for (const Values::ConstKeyValuePair& key_value : values)
+    parts[i++ % nrThreads].insert(key_value.key, key_value.value);
+  for (size_t t = 0; t < trials; ++t) {
+    gttic_(threads_copy_destroy);
+    vector<thread> threads;
+    for (const Values& part : parts)
+      threads.emplace_back([&part]() { Values copy(part); });
+    for (thread& thread : threads) thread.join();
+  }
+
+  tictoc_print_();
+  return 0;
+}
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeValuesRetract.cpp
+ * @brief   Time retracting a large Values of poses and points, batched by type versus
+ *          one virtual retract_ per variable
+ * @date    Oct 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/nonlinear/Values.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::L;
+using symbol_shorthand::X;
+
+int main(int argc, char *argv[]) {
+  const size_t nrPoses = argc > 1 ? atoi(argv[1]) : 100000;
+  const size_t nrPoints = 4 * nrPoses;
+  const size_t trials = 10;
+  cout << "Retracting " << nrPoses << " poses and " << nrPoints << " points, "
+       << trials << " times" << endl;
+
+  Values values;
+  VectorValues delta;
+  for (size_t i = 0; i < nrPoses; ++i) {
+    values.insert(X(i), Pose3(Rot3::Ypr(0.1 * i, 0.2, 0.3), Point3(i, 0, 0)));
+    delta.insert(X(i), (Vector6() << 0.01, -0.02, 0.03, 0.1, 0.2, 0.3).finished());
+  }
+  for (size_t j = 0; j < nrPoints; ++j) {
+    values.insert(L(j), Point3(j, 1, 2));
+    delta.insert(L(j), Vector3(0.1, 0.2, 0.3));
+  }
+
+  // The per-variable path: a virtual retract_ call for each variable
+  vector<const Value*> pointers;
+  vector<const Vector*> deltas;
+  for (const Values::ConstKeyValuePair& key_value : values) {
+    pointers.push_back(&key_value.value);
+    deltas.push_back(&delta.at(key_value.key));
+  }
+  vector<Value*> result(pointers.size());
+  for (size_t t = 0; t < trials; ++t) {
+    gttic_(virtual_retract);
+    for (size_t i = 0; i < pointers.size(); ++i)
+      result[i] = pointers[i]->retract_(*deltas[i]);
+    gttoc_(virtual_retract);
+    for (Value* value : result)
+      value->deallocate_();
+  }
+
+  // The batched path: points come first in key order, then poses
+  for (size_t t = 0; t < trials; ++t) {
+    gttic_(batch_retract);
+    pointers[0]->retractBatch_(nrPoints, &pointers[0], &deltas[0], &result[0]);
+    pointers[nrPoints]->retractBatch_(nrPoses, &pointers[nrPoints], &deltas[nrPoints],
+                                      &result[nrPoints]);
+    gttoc_(batch_retract);
+    for (Value* value : result)
+      value->deallocate_();
+  }
+
+  // The complete Values::retract, including grouping and building the result
+  for (size_t t = 0; t < trials; ++t) {
+    gttic_(Values_retract);
+    const Values retracted = values.retract(delta);
+    gttoc_(Values_retract);
+  }
+
+  tictoc_print_();
+  return 0;
+}